@@ -1,5 +1,5 @@
 // src/argh/argh.cc
-// v0.3.2
+// v0.18.0
 //
 // Author: Cayden Lund
 //   Date: 09/28/2021
@@ -11,12 +11,27 @@
 // License: MIT <opensource.org/licenses/MIT>
 
 #include "argh.h"
-#include "positional_arg.h"
+#include "config.h"
+#include "flat_table.h"
+#include "intern.h"
+#include "options.h"
+#include "scanner.h"
+#include "small_vector.h"
+#include "stats.h"
+#include "token.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <span>
 #include <iterator>
 #include <string>
-#include <unordered_set>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 // The argh namespace contains all of the argh functionality
@@ -68,181 +83,552 @@ namespace argh
     //
     //   * int argc     - The count of command line arguments.
     //   * char *argv[] - The command line arguments.
-    argh::argh(int argc, char *argv[])
+    ARGH_INLINE argh::argh(int argc, char *argv[])
     {
-        initialize();
+        // The timer starts first, so that measuring the arguments and reserving room for them
+        // is counted. initialize resets the statistics, and the timer adds to them when it stops.
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argc, text_length(argc, argv));
 
+        scanner scan;
         for (int i = 1; i < argc; i++)
         {
-            parse_argument(argv[i]);
+            parse_argument(scan, argv[i], i);
         }
     }
     // The argh constructor, as above, but with an array of strings.
     //
     //   * int argc           - The count of command line arguments.
     //   * std::string argv[] - The command line arguments.
-    argh::argh(int argc, std::string argv[])
+    ARGH_INLINE argh::argh(int argc, std::string argv[])
     {
-        initialize();
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argc, text_length(argc, argv));
 
+        scanner scan;
         for (int i = 0; i < argc; i++)
         {
-            parse_argument(argv[i]);
+            parse_argument(scan, argv[i], i);
         }
     }
+    // The argh constructor, as above, but with a registry of known options.
+    //
+    //   * int argc            - The count of command line arguments.
+    //   * char *argv[]        - The command line arguments.
+    //   * const options &opts - The registry of known options.
+    ARGH_INLINE argh::argh(int argc, char *argv[], const options &opts)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argc, text_length(argc, argv));
 
-    // A zero-argument method for initializing the instance variables.
-    void argh::initialize()
+        scanner scan(&opts);
+        for (int i = 1; i < argc; i++)
+        {
+            parse_argument(scan, argv[i], i);
+        }
+    }
+    // The argh constructor, as above, but with an array of strings and a registry of known options.
+    //
+    //   * int argc            - The count of command line arguments.
+    //   * std::string argv[]  - The command line arguments.
+    //   * const options &opts - The registry of known options.
+    ARGH_INLINE argh::argh(int argc, std::string argv[], const options &opts)
     {
-        this->args = std::vector<std::string>();
-        this->flags = std::unordered_set<std::string>();
-        this->parameters = std::unordered_map<std::string, std::string>();
-        this->positional_arguments = std::vector<positional_arg>();
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argc, text_length(argc, argv));
 
-        this->double_dash_set = false;
-        this->last_flag = "";
+        scanner scan(&opts);
+        for (int i = 0; i < argc; i++)
+        {
+            parse_argument(scan, argv[i], i);
+        }
     }
+    // The argh constructor, overloaded to take ownership of a vector of strings.
+    // The characters are not copied; the views point into the owned strings,
+    // which stay where they are when the vector itself is moved.
+    //
+    //   * std::vector<std::string> &&argv - The command line arguments.
+    ARGH_INLINE argh::argh(std::vector<std::string> &&argv)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argv.size(), 0);
+        this->copy_text = false;
+        this->owned = std::make_shared<const std::vector<std::string>>(std::move(argv));
+        ARGH_STAT(this->statistics.allocations++);
 
-    // A private method for parsing a single argument.
+        scanner scan;
+        for (long unsigned int i = 0; i < this->owned->size(); i++)
+        {
+            parse_argument(scan, (*this->owned)[i], i);
+        }
+    }
+    // The argh constructor, as above, but with a registry of known options.
     //
-    //   * std::string arg - The argument to parse.
-    void argh::parse_argument(std::string arg)
+    //   * std::vector<std::string> &&argv - The command line arguments.
+    //   * const options &opts             - The registry of known options.
+    ARGH_INLINE argh::argh(std::vector<std::string> &&argv, const options &opts)
     {
-        // Make sure the argument is not empty.
-        if (arg.length() == 0)
-            return;
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argv.size(), 0);
+        this->copy_text = false;
+        this->owned = std::make_shared<const std::vector<std::string>>(std::move(argv));
+        ARGH_STAT(this->statistics.allocations++);
 
-        // If we've seen a double dash, we're parsing positional arguments.
-        if (double_dash_set)
+        scanner scan(&opts);
+        for (long unsigned int i = 0; i < this->owned->size(); i++)
         {
-            this->args.push_back(arg);
-            positional_arg arg_obj(arg);
-            this->positional_arguments.push_back(arg_obj);
-            return;
+            parse_argument(scan, (*this->owned)[i], i);
         }
+    }
+    // The argh constructor, overloaded to borrow a span of views.
+    //
+    //   * std::span<const std::string_view> argv - The command line arguments.
+    ARGH_INLINE argh::argh(std::span<const std::string_view> argv)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argv.size(), 0);
+        this->copy_text = false;
 
-        // Is the argument a single dash?
-        if (arg == "-")
+        scanner scan;
+        for (long unsigned int i = 0; i < argv.size(); i++)
         {
-            // A single dash is a positional argument.
-            parse_positional_argument(arg);
-            this->last_flag = "";
-            return;
+            parse_argument(scan, argv[i], i);
         }
+    }
+    // The argh constructor, as above, but with a registry of known options.
+    //
+    //   * std::span<const std::string_view> argv - The command line arguments.
+    //   * const options &opts                     - The registry of known options.
+    ARGH_INLINE argh::argh(std::span<const std::string_view> argv, const options &opts)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.constructor_ns));
+        initialize(argv.size(), 0);
+        this->copy_text = false;
 
-        // Is the argument a double dash?
-        if (arg == "--")
+        scanner scan(&opts);
+        for (long unsigned int i = 0; i < argv.size(); i++)
         {
-            // A double dash means that all following arguments are positional arguments.
-            this->args.push_back(arg);
-            this->double_dash_set = true;
-            this->last_flag = "";
+            parse_argument(scan, argv[i], i);
+        }
+    }
+
+    // The copy constructor.
+    //
+    //   * const argh &other - The instance to copy.
+    ARGH_INLINE argh::argh(const argh &other)
+    {
+        adopt(other);
+    }
+
+    // The move constructor.
+    //
+    //   * argh &&other - The instance to move from.
+    ARGH_INLINE argh::argh(argh &&other) noexcept
+    {
+        adopt(std::move(other));
+    }
+
+    // The copy assignment operator.
+    //
+    //   * const argh &other - The instance to copy.
+    ARGH_INLINE argh &argh::operator=(const argh &other)
+    {
+        if (this != &other)
+            adopt(other);
+        return *this;
+    }
+
+    // The move assignment operator.
+    //
+    //   * argh &&other - The instance to move from.
+    ARGH_INLINE argh &argh::operator=(argh &&other) noexcept
+    {
+        if (this != &other)
+            adopt(std::move(other));
+        return *this;
+    }
+
+    // Takes over the state of another instance, by copy or by move.
+    // The views into the other instance's text are then moved over to this one's;
+    // views into borrowed or owned strings stay as they are.
+    //
+    //   * source &&other - The instance to take over from.
+    template <typename source>
+    ARGH_INLINE void argh::adopt(source &&other)
+    {
+        const char *old_text = other.text.data();
+        std::size_t size = other.text.size();
+
+        this->text = std::forward<source>(other).text;
+        this->owned = std::forward<source>(other).owned;
+        this->locals = std::forward<source>(other).locals;
+        this->args = std::forward<source>(other).args;
+        this->flag_list = std::forward<source>(other).flag_list;
+        this->flag_index = std::forward<source>(other).flag_index;
+        this->parameter_list = std::forward<source>(other).parameter_list;
+        this->parameter_index = std::forward<source>(other).parameter_index;
+        this->positional_values = std::forward<source>(other).positional_values;
+        this->positional_owners = std::forward<source>(other).positional_owners;
+        this->ambiguous = std::forward<source>(other).ambiguous;
+        this->rejected = std::forward<source>(other).rejected;
+        this->current_arg = nullptr;
+        this->current_copy = nullptr;
+        this->current_index = 0;
+        this->copy_text = true;
+        ARGH_STAT(this->statistics = other.statistics);
+
+        rebase(old_text, size);
+    }
+
+    // Moves the views that pointed into another instance's text to the same place in this one's.
+    //
+    //   * const char *old_text - The other instance's text, before it was taken over.
+    //   * std::size_t size     - The size of the other instance's text.
+    ARGH_INLINE void argh::rebase(const char *old_text, std::size_t size)
+    {
+        const char *new_text = this->text.data();
+        if (old_text == new_text || size == 0)
             return;
+
+        std::less<const char *> before;
+        auto move_view = [&](std::string_view &view) {
+            if (!before(view.data(), old_text) && before(view.data(), old_text + size))
+                view = std::string_view(new_text + (view.data() - old_text), view.length());
+        };
+        for (std::string_view &arg : this->args)
+            move_view(arg);
+        for (parameter &existing : this->parameter_list)
+            move_view(existing.entry.value);
+    }
+
+    // Returns the total length of the command line arguments.
+    //
+    //   * int argc     - The count of command line arguments.
+    //   * char *argv[] - The command line arguments.
+    //
+    //   * return (std::size_t) - The total length.
+    ARGH_INLINE std::size_t argh::text_length(int argc, char *argv[])
+    {
+        std::size_t length = 0;
+        for (int i = 0; i < argc; i++)
+            length += std::strlen(argv[i]);
+        return length;
+    }
+
+    // Returns the total length of the command line arguments.
+    //
+    //   * int argc           - The count of command line arguments.
+    //   * std::string argv[] - The command line arguments.
+    //
+    //   * return (std::size_t) - The total length.
+    ARGH_INLINE std::size_t argh::text_length(int argc, std::string argv[])
+    {
+        std::size_t length = 0;
+        for (int i = 0; i < argc; i++)
+            length += argv[i].length();
+        return length;
+    }
+
+    // A two-argument method for initializing the instance variables.
+    // Every argument is stored once in args and text, and at most once as a positional argument,
+    // so the storage is reserved up front rather than grown one argument at a time.
+    // Up to the inline capacities, this allocates nothing.
+    //
+    //   * int argc           - The count of command line arguments.
+    //   * std::size_t length - The total length of the command line arguments.
+    ARGH_INLINE void argh::initialize(int argc, std::size_t length)
+    {
+        this->text.clear();
+        this->args.clear();
+        this->flag_list.clear();
+        this->flag_index.clear();
+        this->parameter_list.clear();
+        this->parameter_index.clear();
+        this->positional_values.clear();
+        this->positional_owners.clear();
+        this->owned = nullptr;
+        this->locals = nullptr;
+        this->current_arg = nullptr;
+        this->current_copy = nullptr;
+        this->current_index = 0;
+        this->copy_text = true;
+
+        this->ambiguous = std::vector<std::string>();
+        this->rejected = std::vector<rejected_argument>();
+
+        ARGH_STAT(this->statistics = parse_stats());
+
+        ARGH_STAT(this->statistics.allocations += (length > inline_text));
+        this->text.reserve(length);
+
+        if (argc > 0)
+        {
+            ARGH_STAT(this->statistics.allocations += 3 * ((long unsigned int)argc > inline_args));
+            this->args.reserve(argc);
+            this->positional_values.reserve(argc);
+            this->positional_owners.reserve(argc);
         }
+    }
 
-        // Is the argument a flag?
-        if (is_flag(arg))
+    // A private method for parsing a single argument.
+    // The scanner classifies the argument once, and reports it to the event handlers below.
+    //
+    //   * scanner &scan        - The scanner, which carries state from one argument to the next.
+    //   * std::string_view arg - The argument to parse.
+    //   * int index            - The index of the argument in the argv vector.
+    ARGH_INLINE void argh::parse_argument(scanner &scan, std::string_view arg, int index)
+    {
+        this->current_index = index;
+        ARGH_STAT(growth_probe probe(*this));
+        ARGH_STAT(if (arg.empty()) this->statistics.tokens[(int)token_kind::empty]++);
+
+        scan.scan(arg, *this);
+    }
+
+    // Stores an argument in the original argv vector.
+    // The characters are appended to text; the values found in the argument later are slices of this copy.
+    //
+    //   * std::string_view arg - The argument.
+    //   * token_kind kind      - The kind of the argument.
+    ARGH_INLINE void argh::on_argument(std::string_view arg, [[maybe_unused]] token_kind kind)
+    {
+        ARGH_STAT(this->statistics.tokens[(int)kind]++);
+        ARGH_STAT(if (this->copy_text) this->statistics.bytes_copied += arg.length());
+
+        this->current_arg = arg.data();
+        this->current_copy = arg.data();
+        if (this->copy_text)
         {
-            parse_flag(arg);
-            return;
+            this->current_copy = this->text.data() + this->text.size();
+            this->text.append(arg.data(), arg.length());
         }
+        this->args.push_back(std::string_view(this->current_copy, arg.length()));
+    }
 
-        // If we've made it this far, the argument is either the value of a parameter
-        // or a positional argument.
-        parse_positional_argument(arg);
+    // Stores a flag, by the id of its name.
+    //
+    //   * std::string_view name - The name of the flag.
+    ARGH_INLINE void argh::on_flag(std::string_view name)
+    {
+        insert_flag(name_id(name));
+    }
+
+    // Stores a parameter given with '='.
+    //
+    //   * std::string_view name  - The name of the parameter.
+    //   * std::string_view value - The value of the parameter.
+    ARGH_INLINE void argh::on_parameter(std::string_view name, std::string_view value)
+    {
+        std::uint32_t id = name_id(name);
+        set_parameter(id, locate(value));
+        insert_flag(id);
     }
 
-    // A helper method for parsing a single flag.
+    // Stores a positional argument, which might also be the value of its owner.
+    // The scanner always reports the argument itself first, so it is the last one in args.
     //
-    //  * std::string arg - The argument to parse.
-    void argh::parse_flag(std::string arg)
+    //   * std::string_view value - The positional argument.
+    //   * std::string_view owner - The flag that might own it, or an empty view.
+    ARGH_INLINE void argh::on_positional(std::string_view, std::string_view owner)
     {
-        // Does the argument contain '='?
-        if (arg.find('=') != std::string::npos)
+        std::uint32_t index = this->args.size() - 1;
+        std::uint32_t owner_id = no_name;
+        if (owner.length() > 0)
         {
-            // If so, it's a parameter.
-            std::string key = arg.substr(0, arg.find('='));
-            std::string value = arg.substr(arg.find('=') + 1);
-
-            this->parameters[key] = value;
-            this->flags.insert(key);
-            this->args.push_back(arg);
-            this->last_flag = "";
-            return;
+            owner_id = name_id(owner);
+            set_parameter(owner_id, this->args[index]);
         }
-        // Does the flag start with a double dash?
-        if (arg.length() >= 2 && arg.substr(0, 2) == "--")
+        this->positional_values.push_back(index);
+        this->positional_owners.push_back(owner_id);
+    }
+
+    // Handles a double dash. Nothing needs to be stored.
+    ARGH_INLINE void argh::on_double_dash()
+    {
+    }
+
+    // Stores an ambiguous abbreviation.
+    //
+    //   * std::string_view name - The option, as given.
+    ARGH_INLINE void argh::on_ambiguous(std::string_view name)
+    {
+        ARGH_STAT(this->statistics.copied(name));
+        this->ambiguous.push_back(std::string(name));
+    }
+
+    // Records an argument that failed validation, by its index in the argv vector.
+    //
+    //   * std::string_view arg - The argument.
+    //   * text_problem problem - What is wrong with it.
+    ARGH_INLINE void argh::on_invalid(std::string_view, text_problem problem)
+    {
+        this->rejected.push_back(rejected_argument{this->current_index, problem});
+    }
+
+    // Finds a part of the argument being parsed in its stored copy.
+    //
+    //   * std::string_view part - A view into the argument being parsed.
+    //
+    //   * return (std::string_view) - The same part of the stored copy.
+    ARGH_INLINE std::string_view argh::locate(std::string_view part) const
+    {
+        return std::string_view(this->current_copy + (part.data() - this->current_arg), part.length());
+    }
+
+    // Returns the id of an option name, interning it, or keeping it locally if the shared table has no room.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name.
+    ARGH_INLINE std::uint32_t argh::name_id(std::string_view name)
+    {
+        std::uint32_t id = intern(name);
+        if (id != no_name)
+            return id;
+
+        if (this->locals == nullptr)
         {
-            this->flags.insert(arg);
-            this->args.push_back(arg);
-            this->last_flag = arg;
-            return;
+            ARGH_STAT(this->statistics.allocations++);
+            this->locals = std::make_shared<local_names>();
         }
-        else
+#ifdef ARGH_STATS
+        // A new name is copied into a string of its own, and gets a hash node.
+        if (this->locals->find(name) == no_name)
         {
-            // Treat each character following the single dash as a flag.
-            for (long unsigned int i = 1; i < arg.length(); i++)
-            {
-                std::string flag = "-" + arg.substr(i, 1);
-                this->flags.insert(flag);
-                this->last_flag = flag;
-            }
-            this->args.push_back(arg);
+            this->statistics.copied(name);
+            this->statistics.allocations++;
+        }
+#endif
+        return this->locals->add(name);
+    }
+
+    // Returns the id of an option name, without interning it.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if no instance has seen it.
+    ARGH_INLINE std::uint32_t argh::find_name(std::string_view name) const
+    {
+        std::uint32_t id = find_interned(name);
+        if (id == no_name && this->locals != nullptr)
+            id = this->locals->find(name);
+        return id;
+    }
+
+    // Adds a flag to the set of flags, unless it is already there.
+    // While the flags fit inline, they are scanned; past that, the index is used.
+    //
+    //   * std::uint32_t id - The interned id of the flag.
+    ARGH_INLINE void argh::insert_flag(std::uint32_t id)
+    {
+        if (!this->flag_index.empty())
+        {
+            if (this->flag_index.try_emplace(id, this->flag_list.size()).second)
+                this->flag_list.push_back(id);
             return;
         }
+
+        for (std::uint32_t flag : this->flag_list)
+        {
+            if (flag == id)
+                return;
+        }
+        this->flag_list.push_back(id);
+
+        if (this->flag_list.size() > inline_flags)
+        {
+            for (std::uint32_t i = 0; i < this->flag_list.size(); i++)
+                this->flag_index.try_emplace(this->flag_list[i], i);
+        }
     }
 
-    // A helper method for parsing a single positional argument.
+    // Sets the value of a parameter, replacing any earlier value.
+    // While the parameters fit inline, they are scanned; past that, the index is used.
     //
-    //  * std::string arg - The argument to parse.
-    void argh::parse_positional_argument(std::string arg)
+    //   * std::uint32_t id - The interned id of the parameter.
+    //   * std::string_view value - The value.
+    ARGH_INLINE void argh::set_parameter(std::uint32_t id, std::string_view value)
     {
-        if (this->last_flag.length() > 0)
+        if (!this->parameter_index.empty())
         {
-            this->parameters[this->last_flag] = arg;
-            positional_arg arg_obj(this->last_flag, arg);
-            this->positional_arguments.push_back(arg_obj);
+            auto [found, inserted] = this->parameter_index.try_emplace(id, this->parameter_list.size());
+            if (inserted)
+                this->parameter_list.push_back(parameter{id, {interned_name(id, this->locals.get()), value}});
+            else
+                this->parameter_list[*found].entry.value = value;
+            return;
         }
-        else
+
+        for (parameter &existing : this->parameter_list)
         {
-            positional_arg arg_obj(arg);
-            this->positional_arguments.push_back(arg_obj);
+            if (existing.id == id)
+            {
+                existing.entry.value = value;
+                return;
+            }
         }
+        this->parameter_list.push_back(parameter{id, {interned_name(id, this->locals.get()), value}});
 
-        this->last_flag = "";
-        this->args.push_back(arg);
+        if (this->parameter_list.size() > inline_parameters)
+        {
+            for (std::uint32_t i = 0; i < this->parameter_list.size(); i++)
+                this->parameter_index.try_emplace(this->parameter_list[i].id, i);
+        }
     }
 
-    // A method to determine whether an argument is a flag.
+    // Finds a parameter.
     //
-    //   * std::string arg - The argument to check.
+    //   * std::uint32_t id - The interned id of the parameter.
     //
-    //   * return (bool) - True if the argument is a flag, false otherwise.
-    bool argh::is_flag(std::string arg)
+    //   * return (const parameter *) - The parameter, or nullptr.
+    ARGH_INLINE const argh::parameter *argh::find_parameter(std::uint32_t id) const
     {
-        if (arg.length() < 2)
-            return false;
-        if (arg == "--")
-            return false;
-        return arg[0] == '-';
+        if (!this->parameter_index.empty())
+        {
+            const std::uint32_t *found = this->parameter_index.find(id);
+            return found == nullptr ? nullptr : &this->parameter_list[*found];
+        }
+
+        for (const parameter &existing : this->parameter_list)
+        {
+            if (existing.id == id)
+                return &existing;
+        }
+        return nullptr;
     }
 
     // A method to mark an argument as a parameter, not a positional argument.
     // Note: This method runs in O(N) time, where N is the number of arguments,
-    // provided that there is only one of the given parameter.
+    // no matter how many values the parameter owns: the owners are compared as
+    // integers, and the positional arguments that remain are compacted in a single pass.
     //
     //   * std::string arg - The argument to mark as a parameter.
-    void argh::mark_parameter(std::string arg)
+    ARGH_INLINE void argh::mark_parameter(std::string arg)
+    {
+        remove_owned_positionals(find_name(arg));
+    }
+
+    // Removes the positional arguments that a parameter owns.
+    //
+    //   * std::uint32_t id - The interned id of the parameter, or no_name.
+    ARGH_INLINE void argh::remove_owned_positionals(std::uint32_t id)
     {
-        for (long unsigned int i = 0; i < this->positional_arguments.size(); i++)
+        if (id == no_name)
+            return;
+
+        small_vector<std::uint32_t, inline_args> &owners = this->positional_owners;
+        long unsigned int kept = std::find(owners.begin(), owners.end(), id) - owners.begin();
+        ARGH_STAT(this->statistics.mark_parameter_scans += owners.size());
+        for (long unsigned int i = kept; i < owners.size(); i++)
         {
-            if (this->positional_arguments[i].get_owner() == arg)
-            {
-                this->positional_arguments.erase(this->positional_arguments.begin() + i);
-                mark_parameter(arg);
-                return;
-            }
+            if (owners[i] == id)
+                continue;
+            this->positional_values[kept] = this->positional_values[i];
+            owners[kept] = owners[i];
+            kept++;
         }
+        this->positional_values.resize(kept);
+        owners.resize(kept);
     }
 
     // Overload the [] operator to access a flag by name.
@@ -250,9 +636,9 @@ namespace argh
     //   * std::string name - The name of the flag.
     //
     //   * return (bool) - The value of the flag.
-    bool argh::operator[](std::string name)
+    ARGH_INLINE bool argh::operator[](std::string name)
     {
-        return this->flags.count(name);
+        return has_flag(name);
     }
 
     // Overload the () operator to access a parameter by name.
@@ -260,12 +646,9 @@ namespace argh
     //   * std::string name - The name of the parameter.
     //
     //   * return (std::string) - The value of the parameter.
-    std::string argh::operator()(std::string name)
+    ARGH_INLINE std::string argh::operator()(std::string name)
     {
-        mark_parameter(name);
-        if (this->parameters.count(name))
-            return this->parameters[name];
-        return "";
+        return std::string(parameter_value(name));
     }
 
     // Overload the [] operator to access the positional arguments by index.
@@ -294,18 +677,167 @@ namespace argh
     //   * int index - The index of the positional argument.
     //
     //   * return (std::string) - The value of the positional argument.
-    std::string argh::operator[](int index)
+    ARGH_INLINE std::string argh::operator[](int index)
     {
-        if ((long unsigned int)index < this->positional_arguments.size())
-            return this->positional_arguments[index].get_value();
-        return "";
+        return std::string(positional(index));
     }
 
     // Returns the number of positional arguments.
     //
     //   * return (int) - The number of positional arguments.
-    int argh::size()
+    ARGH_INLINE int argh::size()
     {
-        return this->positional_arguments.size();
+        return this->positional_values.size();
+    }
+
+    // Checks for a flag.
+    //
+    //   * std::string_view name - The name of the flag.
+    //
+    //   * return (bool) - The value of the flag.
+    ARGH_INLINE bool argh::has_flag(std::string_view name)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.query_ns));
+        ARGH_STAT(this->statistics.queries++);
+        std::uint32_t id = find_name(name);
+        if (id == no_name)
+            return false;
+        if (!this->flag_index.empty())
+            return this->flag_index.find(id) != nullptr;
+        return std::find(this->flag_list.begin(), this->flag_list.end(), id) != this->flag_list.end();
+    }
+
+    // Finds the value of a parameter, and marks it as a parameter.
+    //
+    //   * std::string_view name - The name of the parameter.
+    //
+    //   * return (std::string_view) - The value of the parameter, or an empty view.
+    ARGH_INLINE std::string_view argh::parameter_value(std::string_view name)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.query_ns));
+        ARGH_STAT(this->statistics.queries++);
+        std::uint32_t id = find_name(name);
+        remove_owned_positionals(id);
+        const parameter *found = find_parameter(id);
+        if (found != nullptr)
+            return found->entry.value;
+        return std::string_view();
+    }
+
+    // Finds a positional argument.
+    //
+    //   * int index - The index of the positional argument.
+    //
+    //   * return (std::string_view) - The positional argument, or an empty view.
+    ARGH_INLINE std::string_view argh::positional(int index)
+    {
+        ARGH_STAT(stats_timer timer(this->statistics.query_ns));
+        ARGH_STAT(this->statistics.queries++);
+        if ((long unsigned int)index < this->positional_values.size())
+            return this->args[this->positional_values[index]];
+        return std::string_view();
+    }
+
+    // Returns the positional arguments, in order, as views.
+    //
+    //   * return (positional_range) - The positional arguments.
+    ARGH_INLINE argh::positional_range argh::positionals() const
+    {
+        return positional_range(positional_at{this->args.data(), this->positional_values.data()},
+                                this->positional_values.size());
+    }
+
+    // Returns the names of the flags, in the order they were first seen.
+    //
+    //   * return (flag_range) - The names of the flags.
+    ARGH_INLINE argh::flag_range argh::flags() const
+    {
+        return flag_range(flag_at{this->flag_list.data(), this->locals.get()}, this->flag_list.size());
+    }
+
+    // Returns the parameters whose values are known, in the order they were first seen.
+    //
+    //   * return (parameter_range) - The names and values of the parameters.
+    ARGH_INLINE argh::parameter_range argh::parameters() const
+    {
+        return parameter_range(parameter_at{this->parameter_list.data()}, this->parameter_list.size());
+    }
+
+    // Returns the original argv vector, as views.
+    //
+    //   * return (std::span<const std::string_view>) - The arguments.
+    ARGH_INLINE std::span<const std::string_view> argh::raw() const
+    {
+        return std::span<const std::string_view>(this->args.data(), this->args.size());
+    }
+
+    // Returns the long options that abbreviated more than one registered option.
+    // These are stored exactly as they were given.
+    //
+    //   * return (std::vector<std::string>) - The ambiguous options, in order.
+    ARGH_INLINE std::vector<std::string> argh::ambiguous_options()
+    {
+        return this->ambiguous;
+    }
+
+    // Returns the arguments that failed validation.
+    //
+    //   * return (std::vector<rejected_argument>) - The rejected arguments, in order.
+    ARGH_INLINE std::vector<rejected_argument> argh::rejected_arguments()
+    {
+        return this->rejected;
+    }
+
+    // Returns the statistics collected about this instance.
+    //
+    //   * return (const parse_stats &) - The statistics, which are all zero without ARGH_STATS.
+    ARGH_INLINE const parse_stats &argh::stats() const
+    {
+        return this->statistics;
+    }
+
+#ifdef ARGH_STATS
+    // The one-argument constructor that takes a snapshot of the containers.
+    //
+    //   * argh &parser - The instance whose containers to watch.
+    ARGH_INLINE argh::growth_probe::growth_probe(argh &parser) : parser(parser)
+    {
+        this->text_capacity = parser.text.capacity();
+        this->args_capacity = parser.args.capacity();
+        this->positional_capacity = parser.positional_values.capacity();
+        this->flags_capacity = parser.flag_list.capacity();
+        this->flag_index_capacity = parser.flag_index.capacity();
+        this->parameters_capacity = parser.parameter_list.capacity();
+        this->parameter_index_capacity = parser.parameter_index.capacity();
+        this->ambiguous_capacity = parser.ambiguous.capacity();
+        this->rejected_capacity = parser.rejected.capacity();
+    }
+
+    // The destructor records the growth since the snapshot.
+    ARGH_INLINE argh::growth_probe::~growth_probe()
+    {
+        parse_stats &statistics = this->parser.statistics;
+
+        statistics.allocations += this->parser.text.capacity() != this->text_capacity;
+        statistics.allocations += this->parser.args.capacity() != this->args_capacity;
+        // The values and their owners grow together.
+        statistics.allocations += 2 * (this->parser.positional_values.capacity() != this->positional_capacity);
+        statistics.allocations += this->parser.flag_list.capacity() != this->flags_capacity;
+        statistics.allocations += this->parser.parameter_list.capacity() != this->parameters_capacity;
+        statistics.allocations += this->parser.ambiguous.capacity() != this->ambiguous_capacity;
+        statistics.allocations += this->parser.rejected.capacity() != this->rejected_capacity;
+
+        // A hash table can double more than once while it is first filled, so count every doubling.
+        auto doublings = [](long unsigned int before, long unsigned int after) {
+            long int count = 0;
+            for (; before < after; before = before == 0 ? flat_table::group_size : before * 2)
+                count++;
+            return count;
+        };
+        long int rehashes = doublings(this->flag_index_capacity, this->parser.flag_index.capacity())
+                            + doublings(this->parameter_index_capacity, this->parser.parameter_index.capacity());
+        statistics.rehashes += rehashes;
+        statistics.allocations += rehashes;
     }
+#endif
 }
@@ -1,5 +1,5 @@
 // src/argh/argh.h
-// v0.3.1
+// v0.18.0
 //
 // Author: Cayden Lund
 //   Date: 09/28/2021
@@ -13,17 +13,40 @@
 #ifndef ARGH_H
 #define ARGH_H
 
-#include "positional_arg.h"
+#include "config.h"
+#include "flat_table.h"
+#include "intern.h"
+#include "options.h"
+#include "scanner.h"
+#include "small_vector.h"
+#include "stats.h"
+#include "token.h"
+#include "utf8.h"
+#include "views.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
-#include <unordered_set>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 // The argh namespace contains all of the argh functionality
 // and utility functions.
 namespace argh
 {
+    // An argument that failed validation, as listed by argh::rejected_arguments().
+    struct rejected_argument
+    {
+        // The index of the argument in the argv vector given to the constructor.
+        // For the argv vector that main receives, the first argument after the program name is 1.
+        int index;
+
+        // What is wrong with the argument.
+        text_problem problem;
+    };
+
     // The argh::argh class is the main class for the argh utility.
     // Use this class to parse command line arguments from the argv vector.
     //
@@ -67,6 +90,55 @@ namespace argh
     //
     class argh
     {
+    private:
+        // Finds a positional argument by its index. The views live in args.
+        struct positional_at
+        {
+            const std::string_view *args;
+            const std::uint32_t *values;
+
+            const std::string_view &operator()(std::size_t index) const
+            {
+                return this->args[this->values[index]];
+            }
+        };
+
+        // Finds the name of a flag by its index. The views live in the tables of interned names.
+        struct flag_at
+        {
+            const std::uint32_t *ids;
+            const local_names *locals;
+
+            const std::string_view &operator()(std::size_t index) const
+            {
+                return interned_name(this->ids[index], this->locals);
+            }
+        };
+
+        // A parameter, by the interned id of its name, with its name and value as parameters() lists them.
+        struct parameter
+        {
+            std::uint32_t id;
+            parameter_entry entry;
+        };
+
+        // Finds a parameter by its index.
+        struct parameter_at
+        {
+            const parameter *parameters;
+
+            const parameter_entry &operator()(std::size_t index) const
+            {
+                return this->parameters[index].entry;
+            }
+        };
+
+    public:
+        // The ranges returned by positionals(), flags() and parameters().
+        using positional_range = indexed_view<positional_at>;
+        using flag_range = indexed_view<flag_at>;
+        using parameter_range = indexed_view<parameter_at>;
+
     public:
         // The argh constructor.
         //
@@ -80,6 +152,69 @@ namespace argh
         //   * std::string argv[] - The command line arguments.
         argh(int argc, std::string argv[]);
 
+        // The argh constructor, overloaded to accept a registry of known options.
+        // Long options are resolved against the registry, so that any unique
+        // abbreviation of a registered long option is stored under its full name.
+        // The registry is only used during construction.
+        //
+        //   * int argc            - The count of command line arguments.
+        //   * char *argv[]        - The command line arguments.
+        //   * const options &opts - The registry of known options.
+        argh(int argc, char *argv[], const options &opts);
+
+        // The argh constructor, overloaded to accept an array of strings and a registry of known options.
+        //
+        //   * int argc            - The count of command line arguments.
+        //   * std::string argv[]  - The command line arguments.
+        //   * const options &opts - The registry of known options.
+        argh(int argc, std::string argv[], const options &opts);
+
+        // The argh constructor, overloaded to take ownership of a vector of strings.
+        // The characters are not copied: the instance keeps the vector alive, and its
+        // copies share it. As with the array of strings, parsing starts at the first element.
+        //
+        //   * std::vector<std::string> &&argv - The command line arguments.
+        argh(std::vector<std::string> &&argv);
+
+        // The argh constructor, as above, but with a registry of known options.
+        //
+        //   * std::vector<std::string> &&argv - The command line arguments.
+        //   * const options &opts             - The registry of known options.
+        argh(std::vector<std::string> &&argv, const options &opts);
+
+        // The argh constructor, overloaded to borrow a span of views.
+        // Nothing is copied, so the viewed characters must outlive the instance.
+        // Parsing starts at the first element.
+        //
+        //   * std::span<const std::string_view> argv - The command line arguments.
+        argh(std::span<const std::string_view> argv);
+
+        // The argh constructor, as above, but with a registry of known options.
+        //
+        //   * std::span<const std::string_view> argv - The command line arguments.
+        //   * const options &opts                     - The registry of known options.
+        argh(std::span<const std::string_view> argv, const options &opts);
+
+        // The copy constructor.
+        //
+        //   * const argh &other - The instance to copy.
+        argh(const argh &other);
+
+        // The move constructor.
+        //
+        //   * argh &&other - The instance to move from.
+        argh(argh &&other) noexcept;
+
+        // The copy assignment operator.
+        //
+        //   * const argh &other - The instance to copy.
+        argh &operator=(const argh &other);
+
+        // The move assignment operator.
+        //
+        //   * argh &&other - The instance to move from.
+        argh &operator=(argh &&other) noexcept;
+
         // A method to mark an argument as a parameter, not a positional argument.
         //
         //   * std::string arg - The argument to mark as a parameter.
@@ -132,50 +267,296 @@ namespace argh
         //   * return (int) - The number of positional arguments.
         int size();
 
+        // Checks for a flag, as the [] operator does, without copying the name.
+        //
+        //   * std::string_view name - The name of the flag.
+        //
+        //   * return (bool) - The value of the flag.
+        bool has_flag(std::string_view name);
+
+        // Finds the value of a parameter, as the () operator does, without copying the name or the value.
+        // The value points into the arguments, so it is valid for as long as they are.
+        //
+        //   * std::string_view name - The name of the parameter.
+        //
+        //   * return (std::string_view) - The value of the parameter, or an empty view.
+        std::string_view parameter_value(std::string_view name);
+
+        // Finds a positional argument, as the [] operator does, without copying it.
+        //
+        //   * int index - The index of the positional argument.
+        //
+        //   * return (std::string_view) - The positional argument, or an empty view.
+        std::string_view positional(int index);
+
+        // Returns the positional arguments, in order, as views.
+        // The view reflects the current positional arguments, so marking a parameter
+        // (or querying one with the () operator) invalidates it.
+        //
+        //    for (std::string_view file : args.positionals())
+        //        process(file);
+        //
+        //   * return (positional_range) - The positional arguments.
+        positional_range positionals() const;
+
+        // Returns the names of the flags, in the order they were first seen.
+        // This includes the names of parameters given with '=', since those are flags too.
+        //
+        //   * return (flag_range) - The names of the flags.
+        flag_range flags() const;
+
+        // Returns the parameters whose values are known, in the order they were first seen.
+        // That's the parameters given with '=', and those followed by a positional argument.
+        //
+        //    for (auto [name, value] : args.parameters())
+        //        std::cout << name << " = " << value << std::endl;
+        //
+        //   * return (parameter_range) - The names and values of the parameters.
+        parameter_range parameters() const;
+
+        // Returns the original argv vector, as views. Parsing started at its first element.
+        //
+        //   * return (std::span<const std::string_view>) - The arguments.
+        std::span<const std::string_view> raw() const;
+
+        // Returns the long options that abbreviated more than one registered option.
+        // These are stored exactly as they were given.
+        //
+        //   * return (std::vector<std::string>) - The ambiguous options, in order.
+        std::vector<std::string> ambiguous_options();
+
+        // Returns the arguments that failed validation, when the registry of known options asks for it
+        // (see options::validate_text). They are not parsed as anything else.
+        //
+        //   * return (std::vector<rejected_argument>) - The rejected arguments, in order.
+        std::vector<rejected_argument> rejected_arguments();
+
+        // Returns the statistics collected about this instance.
+        // They are only collected when argh.cc is built with ARGH_STATS (the //argh:argh_stats target);
+        // otherwise every count stays zero.
+        //
+        //   * return (const parse_stats &) - The statistics.
+        const parse_stats &stats() const;
+
     private:
-        // A zero-argument method for initializing the instance variables.
-        void initialize();
+        // The scanner reports each argument to the event handlers below.
+        friend class scanner;
+
+        // Returns the total length of the command line arguments.
+        //
+        //   * int argc     - The count of command line arguments.
+        //   * char *argv[] - The command line arguments.
+        //
+        //   * return (std::size_t) - The total length.
+        static std::size_t text_length(int argc, char *argv[]);
+
+        // Returns the total length of the command line arguments.
+        //
+        //   * int argc           - The count of command line arguments.
+        //   * std::string argv[] - The command line arguments.
+        //
+        //   * return (std::size_t) - The total length.
+        static std::size_t text_length(int argc, std::string argv[]);
+
+        // A two-argument method for initializing the instance variables.
+        //
+        //   * int argc           - The count of command line arguments.
+        //   * std::size_t length - The total length of the command line arguments.
+        void initialize(int argc, std::size_t length);
 
         // A helper method to parse a single argument.
         //
-        //   * std::string arg - The argument to parse.
-        void parse_argument(std::string arg);
+        //   * scanner &scan        - The scanner, which carries state from one argument to the next.
+        //   * std::string_view arg - The argument to parse.
+        //   * int index            - The index of the argument in the argv vector.
+        void parse_argument(scanner &scan, std::string_view arg, int index);
 
-        // A helper method to parse a single flag.
+        // Stores an argument in the original argv vector.
         //
-        //   * std::string arg - The argument to parse.
-        void parse_flag(std::string arg);
+        //   * std::string_view arg - The argument.
+        //   * token_kind kind      - The kind of the argument.
+        void on_argument(std::string_view arg, token_kind kind);
 
-        // A helper method to parse a single positional argument.
+        // Stores a flag.
         //
-        //   * std::string arg - The argument to parse.
-        void parse_positional_argument(std::string arg);
+        //   * std::string_view name - The name of the flag.
+        void on_flag(std::string_view name);
 
-        // A helper method to determine whether an argument is a flag.
+        // Stores a parameter given with '='.
         //
-        //   * std::string arg - The argument to check.
+        //   * std::string_view name  - The name of the parameter.
+        //   * std::string_view value - The value of the parameter.
+        void on_parameter(std::string_view name, std::string_view value);
+
+        // Stores a positional argument, which might also be the value of its owner.
         //
-        //   * return (bool) - True if the argument is a flag, false otherwise.
-        static bool is_flag(std::string arg);
+        //   * std::string_view value - The positional argument.
+        //   * std::string_view owner - The flag that might own it, or an empty view.
+        void on_positional(std::string_view value, std::string_view owner);
+
+        // Handles a double dash. Nothing needs to be stored.
+        void on_double_dash();
 
-        // The original argv vector.
-        std::vector<std::string> args;
+        // Stores an ambiguous abbreviation.
+        //
+        //   * std::string_view name - The option, as given.
+        void on_ambiguous(std::string_view name);
 
-        // The set of flags.
-        std::unordered_set<std::string> flags;
+        // Records an argument that failed validation.
+        //
+        //   * std::string_view arg - The argument.
+        //   * text_problem problem - What is wrong with it.
+        void on_invalid(std::string_view arg, text_problem problem);
 
-        // The set of parameters.
-        std::unordered_map<std::string, std::string> parameters;
+        // Removes the positional arguments that a parameter owns.
+        //
+        //   * std::uint32_t id - The interned id of the parameter, or no_name.
+        void remove_owned_positionals(std::uint32_t id);
 
-        // The positional arguments.
-        std::vector<positional_arg> positional_arguments;
+        // Takes over the state of another instance, by copy or by move.
+        //
+        //   * source &&other - The instance to take over from.
+        template <typename source>
+        void adopt(source &&other);
 
-        // Whether we've seen "--" in the arguments.
-        bool double_dash_set;
+        // Moves the views that pointed into another instance's text to the same place in this one's.
+        //
+        //   * const char *old_text - The other instance's text, before it was taken over.
+        //   * std::size_t size     - The size of the other instance's text.
+        void rebase(const char *old_text, std::size_t size);
 
-        // If the last argument was a flag, this is the flag's name.
-        std::string last_flag;
+        // Finds a part of the argument being parsed in its stored copy.
+        //
+        //   * std::string_view part - A view into the argument being parsed.
+        //
+        //   * return (std::string_view) - The same part of the stored copy.
+        std::string_view locate(std::string_view part) const;
+
+        // Returns the id of an option name, interning it, or keeping it locally if the shared table has no room.
+        //
+        //   * std::string_view name - The name.
+        //
+        //   * return (std::uint32_t) - The id of the name.
+        std::uint32_t name_id(std::string_view name);
+
+        // Returns the id of an option name, without interning it.
+        //
+        //   * std::string_view name - The name.
+        //
+        //   * return (std::uint32_t) - The id of the name, or no_name if no instance has seen it.
+        std::uint32_t find_name(std::string_view name) const;
+
+        // Adds a flag to the set of flags, unless it is already there.
+        //
+        //   * std::uint32_t id - The interned id of the flag.
+        void insert_flag(std::uint32_t id);
+
+        // Sets the value of a parameter, replacing any earlier value.
+        //
+        //   * std::uint32_t id - The interned id of the parameter.
+        //   * std::string_view value - The value.
+        void set_parameter(std::uint32_t id, std::string_view value);
+
+        // Finds a parameter.
+        //
+        //   * std::uint32_t id - The interned id of the parameter.
+        //
+        //   * return (const parameter *) - The parameter, or nullptr.
+        const parameter *find_parameter(std::uint32_t id) const;
+
+        // The inline capacities. A typical command line fits in them, so parsing it never allocates.
+        static constexpr std::size_t inline_args = 16;
+        static constexpr std::size_t inline_text = 256;
+        static constexpr std::size_t inline_flags = 16;
+        static constexpr std::size_t inline_parameters = 8;
+
+        // The characters of every argument, back to back, unless the instance borrows or owns them.
+        // It is reserved up front, so that it never moves while the views into it are made.
+        small_vector<char, inline_text> text;
+
+        // The strings that the instance owns, if it was given a vector of strings.
+        std::shared_ptr<const std::vector<std::string>> owned;
+
+        // The option names that the shared table had no room for, if there were any.
+        // They are only added while parsing, so copies of the instance share them.
+        std::shared_ptr<local_names> locals;
+
+        // The original argv vector, as views into text or into the borrowed or owned strings.
+        small_vector<std::string_view, inline_args> args;
+
+        // The set of flags, by the interned ids of their names, in the order they were first seen.
+        small_vector<std::uint32_t, inline_flags> flag_list;
+
+        // Once there are more flags than fit inline, the position of each flag by id, for constant-time lookups.
+        flat_table flag_index;
+
+        // The parameters, in the order they were first seen.
+        small_vector<parameter, inline_parameters> parameter_list;
+
+        // Once there are more parameters than fit inline, the position of each one by id.
+        flat_table parameter_index;
+
+        // The positional arguments, stored as two parallel arrays.
+        // Note that since we can't tell a positional argument from the value of a parameter,
+        // each one also records the flag that might own it. When the user marks a parameter
+        // as such, argh removes the positional arguments that belong to it.
+        //
+        // The values, as indices into the original argv vector.
+        small_vector<std::uint32_t, inline_args> positional_values;
+        // The interned ids of their owners, or no_name.
+        small_vector<std::uint32_t, inline_args> positional_owners;
+
+        // The argument being parsed, and where its stored copy starts.
+        // Only used during construction, to locate values within the argument.
+        const char *current_arg;
+        const char *current_copy;
+
+        // The index of the argument being parsed in the argv vector. Only used during construction.
+        int current_index;
+
+        // Whether the arguments are copied into text. Only used during construction.
+        bool copy_text;
+
+        // The long options that abbreviated more than one registered option.
+        std::vector<std::string> ambiguous;
+
+        // The arguments that failed validation.
+        std::vector<rejected_argument> rejected;
+
+        // Records how much the containers grow while parsing a single argument.
+        // Only defined when argh.cc is built with ARGH_STATS; the layout is the same either way.
+        struct growth_probe
+        {
+            // The one-argument constructor that takes a snapshot of the containers.
+            //
+            //   * argh &parser - The instance whose containers to watch.
+            growth_probe(argh &parser);
+
+            // The destructor records the growth since the snapshot.
+            ~growth_probe();
+
+            // The instance whose containers to watch.
+            argh &parser;
+
+            // The snapshot of the containers.
+            long unsigned int text_capacity;
+            long unsigned int args_capacity;
+            long unsigned int positional_capacity;
+            long unsigned int flags_capacity;
+            long unsigned int flag_index_capacity;
+            long unsigned int parameters_capacity;
+            long unsigned int parameter_index_capacity;
+            long unsigned int ambiguous_capacity;
+            long unsigned int rejected_capacity;
+        };
+
+        // The statistics collected about this instance.
+        parse_stats statistics;
     };
 }
 
+#ifdef ARGH_HEADER_ONLY
+#include "argh.cc"
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+// src/argh/argh_c.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the C API of the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "argh_c.h"
+
+#include "argh.h"
+#include "small_vector.h"
+
+#include <cstddef>
+#include <new>
+#include <span>
+#include <string_view>
+
+// The handle is an argh instance that borrows the caller's argv.
+struct argh_parser
+{
+    // The one-argument constructor.
+    //
+    //   * std::span<const std::string_view> argv - The command line arguments, without the program name.
+    argh_parser(std::span<const std::string_view> argv) : args(argv)
+    {
+    }
+
+    // The parsed arguments.
+    argh::argh args;
+};
+
+// Stores the length of a view, if the caller asked for it, and returns its characters.
+//
+//   * std::string_view value - The view.
+//   * size_t *length         - Where to store the length, or NULL.
+//
+//   * return (const char *) - The characters, or NULL for an empty view that points nowhere.
+static const char *borrow(std::string_view value, size_t *length)
+{
+    if (length != NULL)
+        *length = value.length();
+    return value.data();
+}
+
+// Parses the argv vector that main receives, skipping the program name.
+//
+//   * int argc                 - The count of command line arguments.
+//   * const char *const argv[] - The command line arguments.
+//
+//   * return (argh_parser *) - The handle, or NULL if there was not enough memory.
+extern "C" argh_parser *argh_parse(int argc, const char *const argv[])
+{
+    // No exception may cross into C.
+    try
+    {
+        argh::small_vector<std::string_view, 16> views;
+        for (int i = 1; i < argc; i++)
+            views.push_back(argv[i]);
+        return new argh_parser(std::span<const std::string_view>(views.data(), views.size()));
+    }
+    catch (...)
+    {
+        return NULL;
+    }
+}
+
+// Checks for a flag.
+//
+//   * argh_parser *parser - The handle.
+//   * const char *name    - The name of the flag.
+//
+//   * return (int) - 1 if the flag was given, 0 otherwise.
+extern "C" int argh_has_flag(argh_parser *parser, const char *name)
+{
+    return parser->args.has_flag(name);
+}
+
+// Finds the value of a parameter, and marks it as a parameter.
+//
+//   * argh_parser *parser - The handle.
+//   * const char *name    - The name of the parameter.
+//   * size_t *length      - Where to store the length of the value, or NULL.
+//
+//   * return (const char *) - The value, or NULL if the parameter has no value.
+extern "C" const char *argh_get_param(argh_parser *parser, const char *name, size_t *length)
+{
+    return borrow(parser->args.parameter_value(name), length);
+}
+
+// Finds a positional argument.
+//
+//   * argh_parser *parser - The handle.
+//   * int index           - The index of the positional argument.
+//   * size_t *length      - Where to store the length of the argument, or NULL.
+//
+//   * return (const char *) - The argument, or NULL if there is no such argument.
+extern "C" const char *argh_positional(argh_parser *parser, int index, size_t *length)
+{
+    return borrow(parser->args.positional(index), length);
+}
+
+// Returns the number of positional arguments.
+//
+//   * argh_parser *parser - The handle.
+//
+//   * return (int) - The number of positional arguments.
+extern "C" int argh_positional_count(argh_parser *parser)
+{
+    return parser->args.size();
+}
+
+// Frees a handle.
+//
+//   * argh_parser *parser - The handle, or NULL.
+extern "C" void argh_free(argh_parser *parser)
+{
+    delete parser;
+}
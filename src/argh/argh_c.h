@@ -0,0 +1,90 @@
+// src/argh/argh_c.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the C API headers of the argh library.
+// Use this interface to parse command line arguments from C.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef ARGH_C_H
+#define ARGH_C_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // The parsed command line arguments, behind an opaque handle.
+    //
+    //    argh_parser *args = argh_parse(argc, argv);
+    //    if (argh_has_flag(args, "-v"))
+    //        ...
+    //    size_t length;
+    //    const char *output = argh_get_param(args, "-o", &length);
+    //    argh_free(args);
+    //
+    // Nothing is copied: the strings that the queries return point into argv, so argv
+    // must outlive the handle. Each one is the end of one of argv's strings, so it is
+    // terminated, and its length is there to save a call to strlen.
+    //
+    // The layout of the handle is private, so programs keep working as argh changes.
+    typedef struct argh_parser argh_parser;
+
+    // Parses the argv vector that main receives, skipping the program name.
+    //
+    //   * int argc                 - The count of command line arguments.
+    //   * const char *const argv[] - The command line arguments.
+    //
+    //   * return (argh_parser *) - The handle, or NULL if there was not enough memory.
+    argh_parser *argh_parse(int argc, const char *const argv[]);
+
+    // Checks for a flag.
+    //
+    //   * argh_parser *parser - The handle.
+    //   * const char *name    - The name of the flag, such as "-v" or "--verbose".
+    //
+    //   * return (int) - 1 if the flag was given, 0 otherwise.
+    int argh_has_flag(argh_parser *parser, const char *name);
+
+    // Finds the value of a parameter, and marks it as a parameter, so that
+    // its value is no longer counted among the positional arguments.
+    //
+    //   * argh_parser *parser - The handle.
+    //   * const char *name    - The name of the parameter.
+    //   * size_t *length      - Where to store the length of the value. May be NULL.
+    //
+    //   * return (const char *) - The value, which points into argv, or NULL if the parameter has no value.
+    const char *argh_get_param(argh_parser *parser, const char *name, size_t *length);
+
+    // Finds a positional argument.
+    //
+    //   * argh_parser *parser - The handle.
+    //   * int index           - The index of the positional argument.
+    //   * size_t *length      - Where to store the length of the argument. May be NULL.
+    //
+    //   * return (const char *) - The argument, which points into argv, or NULL if there is no such argument.
+    const char *argh_positional(argh_parser *parser, int index, size_t *length);
+
+    // Returns the number of positional arguments.
+    //
+    //   * argh_parser *parser - The handle.
+    //
+    //   * return (int) - The number of positional arguments.
+    int argh_positional_count(argh_parser *parser);
+
+    // Frees a handle. Freeing NULL does nothing.
+    //
+    //   * argh_parser *parser - The handle.
+    void argh_free(argh_parser *parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+// src/argh/async.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of asynchronous parsing.
+// Use this utility to read and parse expensive argument sources while the program starts up.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "async.h"
+
+#include "argh.h"
+#include "options.h"
+#include "tokens.h"
+
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace argh
+{
+    namespace
+    {
+        // How deeply response files may name other response files.
+        constexpr int max_response_depth = 16;
+
+        // Returns whether a path names a regular file, following symbolic links.
+        // Anything else, such as a directory or a FIFO, is not read as a response file.
+        //
+        //   * const std::string &path - The path.
+        //
+        //   * return (bool) - True if the path names a regular file.
+        bool regular_file(const std::string &path)
+        {
+            struct stat info;
+            return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+        }
+
+        // Appends arguments to a vector, replacing each "@file" by the arguments in the file.
+        //
+        //   * std::vector<std::string> &args - The arguments. Their strings are moved from.
+        //   * std::vector<std::string> &out  - The vector to append the arguments to.
+        //   * int depth                      - How many response files deep the arguments are.
+        void expand(std::vector<std::string> &args, std::vector<std::string> &out, int depth)
+        {
+            for (std::string &arg : args)
+            {
+                std::ifstream file;
+                if (arg.length() > 1 && arg[0] == '@' && depth < max_response_depth && regular_file(arg.substr(1)))
+                    file.open(arg.substr(1));
+                if (!file.is_open())
+                {
+                    out.push_back(std::move(arg));
+                    continue;
+                }
+
+                std::vector<std::string> inner;
+                for (const classified_argument &word : tokenize_file(file))
+                    inner.emplace_back(word.text);
+                expand(inner, out, depth + 1);
+            }
+        }
+
+        // Starts parsing on another thread.
+        //
+        //   * std::vector<std::string> args - The arguments.
+        //   * const options *registry       - The registry of known options, or nullptr.
+        //   * parse_callback on_ready       - A function to call when the arguments are parsed, or nullptr.
+        //
+        //   * return (pending_argh) - The handle to the instance.
+        pending_argh start(std::vector<std::string> args, const options *registry, parse_callback on_ready)
+        {
+            auto parse = [args = std::move(args), registry, on_ready = std::move(on_ready)]() mutable {
+                std::vector<std::string> expanded;
+                if (registry != nullptr && registry->reads_response_files())
+                {
+                    expanded.reserve(args.size());
+                    expand(args, expanded, 0);
+                }
+                else
+                    expanded = std::move(args);
+
+                std::shared_ptr<argh> parsed = registry != nullptr
+                                                   ? std::make_shared<argh>(std::move(expanded), *registry)
+                                                   : std::make_shared<argh>(std::move(expanded));
+                if (on_ready)
+                    on_ready(*parsed);
+                return parsed;
+            };
+            return pending_argh(std::async(std::launch::async, std::move(parse)).share());
+        }
+
+        // Copies the argv vector that main receives, skipping the program name.
+        //
+        //   * int argc     - The count of command line arguments.
+        //   * char *argv[] - The command line arguments.
+        //
+        //   * return (std::vector<std::string>) - The arguments.
+        std::vector<std::string> copy_argv(int argc, char *argv[])
+        {
+            std::vector<std::string> args;
+            for (int i = 1; i < argc; i++)
+                args.emplace_back(argv[i]);
+            return args;
+        }
+    }
+
+    // The zero-argument constructor that creates a handle to nothing. Its queries must not be called.
+    pending_argh::pending_argh()
+    {
+    }
+
+    // The one-argument constructor, for parse_async.
+    //
+    //   * std::shared_future<std::shared_ptr<argh>> result - The parsed instance, when it's ready.
+    pending_argh::pending_argh(std::shared_future<std::shared_ptr<argh>> result) : result(std::move(result))
+    {
+    }
+
+    // Returns whether the parse has finished, without waiting.
+    //
+    //   * return (bool) - True if the queries won't wait.
+    bool pending_argh::ready() const
+    {
+        return this->result.valid() && this->result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Waits for the parse to finish.
+    void pending_argh::wait() const
+    {
+        this->result.wait();
+    }
+
+    // Returns the parsed instance, waiting for it if necessary.
+    //
+    //   * return (argh &) - The instance. It lives as long as any handle to it.
+    argh &pending_argh::get() const
+    {
+        return *this->result.get();
+    }
+
+    // Checks for a flag, as argh::has_flag does.
+    //
+    //   * std::string_view name - The name of the flag.
+    //
+    //   * return (bool) - The value of the flag.
+    bool pending_argh::has_flag(std::string_view name) const
+    {
+        return get().has_flag(name);
+    }
+
+    // Finds the value of a parameter, as argh::parameter_value does.
+    //
+    //   * std::string_view name - The name of the parameter.
+    //
+    //   * return (std::string_view) - The value of the parameter, or an empty view.
+    std::string_view pending_argh::parameter_value(std::string_view name) const
+    {
+        return get().parameter_value(name);
+    }
+
+    // Finds a positional argument, as argh::positional does.
+    //
+    //   * int index - The index of the positional argument.
+    //
+    //   * return (std::string_view) - The positional argument, or an empty view.
+    std::string_view pending_argh::positional(int index) const
+    {
+        return get().positional(index);
+    }
+
+    // Returns the number of positional arguments.
+    //
+    //   * return (int) - The number of positional arguments.
+    int pending_argh::size() const
+    {
+        return get().size();
+    }
+
+    // Parses arguments on another thread, so that reading and parsing them overlaps with the rest of startup.
+    //
+    //   * std::vector<std::string> args - The arguments.
+    //   * parse_callback on_ready       - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(std::vector<std::string> args, parse_callback on_ready)
+    {
+        return start(std::move(args), nullptr, std::move(on_ready));
+    }
+
+    // Parses arguments on another thread, as above, but with a registry of known options.
+    //
+    //   * std::vector<std::string> args - The arguments.
+    //   * const options &opts           - The registry of known options. It must outlive the parse.
+    //   * parse_callback on_ready       - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(std::vector<std::string> args, const options &opts, parse_callback on_ready)
+    {
+        return start(std::move(args), &opts, std::move(on_ready));
+    }
+
+    // Parses the argv vector that main receives on another thread, skipping the program name.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments. They are copied before this returns.
+    //   * parse_callback on_ready - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(int argc, char *argv[], parse_callback on_ready)
+    {
+        return start(copy_argv(argc, argv), nullptr, std::move(on_ready));
+    }
+
+    // Parses the argv vector that main receives on another thread, as above, but with a registry of known options.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments. They are copied before this returns.
+    //   * const options &opts     - The registry of known options. It must outlive the parse.
+    //   * parse_callback on_ready - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(int argc, char *argv[], const options &opts, parse_callback on_ready)
+    {
+        return start(copy_argv(argc, argv), &opts, std::move(on_ready));
+    }
+}
@@ -0,0 +1,144 @@
+// src/argh/async.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the asynchronous parsing headers.
+// Use this utility to read and parse expensive argument sources while the program starts up.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include "argh.h"
+#include "options.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // The function that parse_async calls when the arguments are parsed.
+    // It runs on the parsing thread, before any query can see the instance, so it may mark parameters.
+    using parse_callback = std::function<void(argh &)>;
+
+    // The argh::pending_argh class is the handle that parse_async returns.
+    // Its queries are those of the argh class, and each one waits for the parse to finish
+    // if it hasn't yet. Copies of the handle share the same instance.
+    //
+    //    argh::pending_argh args = argh::parse_async(argc, argv);
+    //    start_logging();
+    //    connect_to_database();
+    //    if (args.has_flag("--verbose"))
+    //        ...
+    //
+    // Like the argh class, the instance must only be queried from one thread at a time.
+    // If reading or parsing throws, the exception is thrown again by every query.
+    // Destroying the last handle before the parse finishes waits for it to finish.
+    class pending_argh
+    {
+        public:
+        // The zero-argument constructor that creates a handle to nothing. Its queries must not be called.
+        pending_argh();
+
+        // The one-argument constructor, for parse_async.
+        //
+        //   * std::shared_future<std::shared_ptr<argh>> result - The parsed instance, when it's ready.
+        explicit pending_argh(std::shared_future<std::shared_ptr<argh>> result);
+
+        // Returns whether the parse has finished, without waiting.
+        //
+        //   * return (bool) - True if the queries won't wait.
+        bool ready() const;
+
+        // Waits for the parse to finish.
+        void wait() const;
+
+        // Returns the parsed instance, waiting for it if necessary.
+        //
+        //   * return (argh &) - The instance. It lives as long as any handle to it.
+        argh &get() const;
+
+        // Checks for a flag, as argh::has_flag does.
+        //
+        //   * std::string_view name - The name of the flag.
+        //
+        //   * return (bool) - The value of the flag.
+        bool has_flag(std::string_view name) const;
+
+        // Finds the value of a parameter, as argh::parameter_value does.
+        //
+        //   * std::string_view name - The name of the parameter.
+        //
+        //   * return (std::string_view) - The value of the parameter, or an empty view.
+        std::string_view parameter_value(std::string_view name) const;
+
+        // Finds a positional argument, as argh::positional does.
+        //
+        //   * int index - The index of the positional argument.
+        //
+        //   * return (std::string_view) - The positional argument, or an empty view.
+        std::string_view positional(int index) const;
+
+        // Returns the number of positional arguments.
+        //
+        //   * return (int) - The number of positional arguments.
+        int size() const;
+
+        private:
+        // The parsed instance, when it's ready.
+        std::shared_future<std::shared_ptr<argh>> result;
+    };
+
+    // Parses arguments on another thread, so that reading and parsing them overlaps with the rest of startup.
+    // As with the array of strings, parsing starts at the first element.
+    //
+    // If the registry reads response files (see options::read_response_files), arguments of the
+    // form "@file" are replaced by the arguments in that file, split as tokenize_file splits them;
+    // response files may name other response files, up to 16 deep. An argument naming anything
+    // but a regular file that can be read is kept as it is, as GCC does. Without a registry,
+    // or by default, the arguments are parsed exactly as the argh constructors parse them.
+    //
+    //   * std::vector<std::string> args - The arguments.
+    //   * parse_callback on_ready       - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(std::vector<std::string> args, parse_callback on_ready = nullptr);
+
+    // Parses arguments on another thread, as above, but with a registry of known options.
+    //
+    //   * std::vector<std::string> args - The arguments.
+    //   * const options &opts           - The registry of known options. It must outlive the parse.
+    //   * parse_callback on_ready       - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(std::vector<std::string> args, const options &opts, parse_callback on_ready = nullptr);
+
+    // Parses the argv vector that main receives on another thread, skipping the program name.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments. They are copied before this returns.
+    //   * parse_callback on_ready - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(int argc, char *argv[], parse_callback on_ready = nullptr);
+
+    // Parses the argv vector that main receives on another thread, as above, but with a registry of known options.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments. They are copied before this returns.
+    //   * const options &opts     - The registry of known options. It must outlive the parse.
+    //   * parse_callback on_ready - A function to call on the parsing thread when the arguments are parsed, or nullptr.
+    //
+    //   * return (pending_argh) - The handle to the instance.
+    pending_argh parse_async(int argc, char *argv[], const options &opts, parse_callback on_ready = nullptr);
+}
+
+#endif
@@ -0,0 +1,195 @@
+// src/argh/bench/argh.bench.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the benchmarks for the argh library.
+// They measure parsing across argv sizes and shapes, and the cost of each query.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/argh.h"
+#include "argh/bench/perf_counters.h"
+
+#include <string>
+#include <vector>
+
+// Builds an argv vector of n tokens. Every token for which is_flag(i) is true
+// is a long flag; the rest are positional arguments.
+template <typename predicate>
+static std::vector<std::string> make_argv(int n, predicate is_flag)
+{
+    std::vector<std::string> argv;
+    argv.reserve(n);
+    for (int i = 0; i < n; i++)
+    {
+        if (is_flag(i))
+            argv.push_back("--flag-" + std::to_string(i % 64));
+        else
+            argv.push_back("positional-argument-" + std::to_string(i));
+    }
+    return argv;
+}
+
+// Converts an argv vector of strings to the char * form that main receives,
+// with a program name in front.
+static std::vector<char *> as_char_argv(std::vector<std::string> &argv)
+{
+    static char program[] = "prg";
+    std::vector<char *> pointers = {program};
+    for (std::string &arg : argv)
+        pointers.push_back(arg.data());
+    return pointers;
+}
+
+// Reports the number of tokens parsed per second.
+// With ARGH_PERF_COUNTERS set, each benchmark also reports hardware counters per token.
+static void set_tokens(benchmark::State &state, long int tokens)
+{
+    state.SetItemsProcessed(state.iterations() * tokens);
+    state.counters["tokens"] = tokens;
+}
+
+// Parses n tokens, a quarter of which are flags, through the std::string constructor.
+static void BM_construct_strings(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0), [](int i) { return i % 4 == 0; });
+    argh::perf_scope perf(state, argv.size());
+    for (auto _ : state)
+    {
+        argh::argh args(argv.size(), argv.data());
+        benchmark::DoNotOptimize(args);
+    }
+    set_tokens(state, argv.size());
+}
+BENCHMARK(BM_construct_strings)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Parses n tokens, a quarter of which are flags, through the char * constructor.
+static void BM_construct_chars(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0), [](int i) { return i % 4 == 0; });
+    std::vector<char *> pointers = as_char_argv(argv);
+    argh::perf_scope perf(state, argv.size());
+    for (auto _ : state)
+    {
+        argh::argh args(pointers.size(), pointers.data());
+        benchmark::DoNotOptimize(args);
+    }
+    set_tokens(state, argv.size());
+}
+BENCHMARK(BM_construct_chars)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Parses 10,000 tokens, of which the given percentage are flags.
+static void BM_construct_flag_density(benchmark::State &state)
+{
+    int density = state.range(0);
+    std::vector<std::string> argv = make_argv(10000, [density](int i) { return i % 100 < density; });
+    argh::perf_scope perf(state, argv.size());
+    for (auto _ : state)
+    {
+        argh::argh args(argv.size(), argv.data());
+        benchmark::DoNotOptimize(args);
+    }
+    set_tokens(state, argv.size());
+}
+BENCHMARK(BM_construct_flag_density)->DenseRange(0, 100, 25)->Unit(benchmark::kMicrosecond);
+
+// Parses n "--key=value" parameters.
+static void BM_construct_equals_parameters(benchmark::State &state)
+{
+    std::vector<std::string> argv;
+    for (int i = 0; i < state.range(0); i++)
+        argv.push_back("--parameter-" + std::to_string(i % 256) + "=value-" + std::to_string(i));
+    argh::perf_scope perf(state, argv.size());
+    for (auto _ : state)
+    {
+        argh::argh args(argv.size(), argv.data());
+        benchmark::DoNotOptimize(args);
+    }
+    set_tokens(state, argv.size());
+}
+BENCHMARK(BM_construct_equals_parameters)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Parses n clusters of short flags, each eight letters long.
+static void BM_construct_short_clusters(benchmark::State &state)
+{
+    std::vector<std::string> argv;
+    for (int i = 0; i < state.range(0); i++)
+        argv.push_back(i % 2 == 0 ? "-abcdefgh" : "-ijklmnop");
+    argh::perf_scope perf(state, argv.size());
+    for (auto _ : state)
+    {
+        argh::argh args(argv.size(), argv.data());
+        benchmark::DoNotOptimize(args);
+    }
+    set_tokens(state, argv.size());
+}
+BENCHMARK(BM_construct_short_clusters)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Looks up present and absent flags with operator[].
+static void BM_query_flag(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0), [](int i) { return i % 2 == 0; });
+    argh::argh args(argv.size(), argv.data());
+    std::vector<std::string> names = {"--flag-0", "--flag-17", "--flag-63", "--absent", "-v"};
+    argh::perf_scope perf(state, names.size());
+    for (auto _ : state)
+    {
+        for (const std::string &name : names)
+            benchmark::DoNotOptimize(args[name]);
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_query_flag)->RangeMultiplier(10)->Range(10, 100000);
+
+// Looks up the value of a parameter with operator(), which also marks it as a parameter.
+static void BM_query_parameter(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0), [](int i) { return i % 2 == 0; });
+    argh::argh args(argv.size(), argv.data());
+    argh::perf_scope perf(state, 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(args("--flag-0"));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_query_parameter)->RangeMultiplier(10)->Range(10, 100000);
+
+// Reads every positional argument with operator[].
+static void BM_query_positional(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0), [](int) { return false; });
+    argh::argh args(argv.size(), argv.data());
+    argh::perf_scope perf(state, args.size());
+    for (auto _ : state)
+    {
+        for (int i = 0; i < args.size(); i++)
+            benchmark::DoNotOptimize(args[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * args.size());
+}
+BENCHMARK(BM_query_positional)->RangeMultiplier(10)->Range(10, 100000);
+
+// Marks a parameter that owns n values ("-o value -o value ...") on a fresh parse each time.
+static void BM_mark_parameter(benchmark::State &state)
+{
+    std::vector<std::string> argv;
+    for (int i = 0; i < state.range(0); i++)
+    {
+        argv.push_back("-o");
+        argv.push_back("value-" + std::to_string(i));
+    }
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        argh::argh args(argv.size(), argv.data());
+        state.ResumeTiming();
+        args.mark_parameter("-o");
+        benchmark::DoNotOptimize(args);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_mark_parameter)->RangeMultiplier(10)->Range(10, 1000000)->Unit(benchmark::kMicrosecond);
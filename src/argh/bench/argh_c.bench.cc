@@ -0,0 +1,107 @@
+// src/argh/bench/argh_c.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the benchmarks for the argh C API.
+// Each one is paired with the same work done through the C++ class,
+// to measure the overhead of crossing the ABI.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/argh.h"
+#include "argh/argh_c.h"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Builds an argv vector, as main would receive it: a program name, a few flags,
+// a parameter, and n short positional arguments.
+static std::vector<std::string> make_argv(int n)
+{
+    std::vector<std::string> argv = {"prg", "-v", "--color", "-o", "out.txt"};
+    for (int i = 0; i < n; i++)
+        argv.push_back("f" + std::to_string(i));
+    return argv;
+}
+
+// Returns pointers to the strings of an argv vector.
+static std::vector<const char *> pointers(const std::vector<std::string> &argv)
+{
+    std::vector<const char *> result;
+    for (const std::string &arg : argv)
+        result.push_back(arg.c_str());
+    return result;
+}
+
+// Parses through the C API.
+static void BM_c_parse(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0));
+    std::vector<const char *> ptrs = pointers(argv);
+    for (auto _ : state)
+    {
+        argh_parser *args = argh_parse(ptrs.size(), ptrs.data());
+        benchmark::DoNotOptimize(args);
+        argh_free(args);
+    }
+    state.SetItemsProcessed(state.iterations() * (argv.size() - 1));
+}
+BENCHMARK(BM_c_parse)->Arg(4)->Arg(64);
+
+// Parses the same views through the C++ class.
+static void BM_cpp_parse(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0));
+    std::vector<std::string_view> views(argv.begin() + 1, argv.end());
+    for (auto _ : state)
+    {
+        argh::argh args{std::span<const std::string_view>(views)};
+        benchmark::DoNotOptimize(args);
+    }
+    state.SetItemsProcessed(state.iterations() * views.size());
+}
+BENCHMARK(BM_cpp_parse)->Arg(4)->Arg(64);
+
+// Checks the same few options on every iteration through the C API.
+static void BM_c_query(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(8);
+    std::vector<const char *> ptrs = pointers(argv);
+    argh_parser *args = argh_parse(ptrs.size(), ptrs.data());
+    for (auto _ : state)
+    {
+        int enabled = argh_has_flag(args, "-v") + argh_has_flag(args, "--color") + argh_has_flag(args, "-q");
+        std::size_t length;
+        benchmark::DoNotOptimize(enabled);
+        benchmark::DoNotOptimize(argh_get_param(args, "-o", &length));
+        benchmark::DoNotOptimize(argh_positional(args, 3, &length));
+    }
+    state.SetItemsProcessed(state.iterations() * 5);
+    argh_free(args);
+}
+BENCHMARK(BM_c_query);
+
+// Checks the same few options on every iteration through the C++ class.
+static void BM_cpp_query(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(8);
+    std::vector<std::string_view> views(argv.begin() + 1, argv.end());
+    argh::argh args{std::span<const std::string_view>(views)};
+    for (auto _ : state)
+    {
+        int enabled = args.has_flag("-v") + args.has_flag("--color") + args.has_flag("-q");
+        benchmark::DoNotOptimize(enabled);
+        benchmark::DoNotOptimize(args.parameter_value("-o"));
+        benchmark::DoNotOptimize(args.positional(3));
+    }
+    state.SetItemsProcessed(state.iterations() * 5);
+}
+BENCHMARK(BM_cpp_query);
@@ -0,0 +1,294 @@
+// src/argh/bench/compare.bench.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the comparative benchmark of argh, glibc's getopt_long,
+// and a minimal hand-written parsing loop.
+//
+// Every parser runs the same workloads and answers the same questions:
+// which flags are present, what the value of the output parameter is,
+// and how many positional arguments there are. If the parsers disagree on any
+// workload, the benchmark says so and exits with a failure. Each measurement runs
+// in its own child process, which reports how far its peak RSS grew past the RSS
+// it started with, so that the workloads that the parent built aren't counted.
+// The results are printed as one JSON object per line:
+//
+//    {"workload":"small","parser":"argh","tokens":7,"parses":...,"tokens_per_second":...,
+//     "allocations_per_parse":...,"bytes_per_parse":...,"peak_rss_growth_kb":...,"ratio_to_getopt_long":...}
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "argh/argh.h"
+#include "argh/tests/alloc_counter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// The answers that every parser must produce for a command line.
+struct answers
+{
+    // The number of short and long flags seen, counting repeats once per flag.
+    int flags;
+
+    // The length of the value of the output parameter.
+    int output_length;
+
+    // The number of positional arguments.
+    int positionals;
+};
+
+// A workload: a named argv vector.
+struct workload
+{
+    std::string name;
+    std::vector<std::string> tokens;
+};
+
+// The single-letter flags that the workloads use. "o" takes a value.
+static const char short_options[] = "abcdefghijklmnvo:";
+
+// The long options that the workloads use.
+static const option long_options[] = {
+    {"verbose", no_argument, nullptr, 'V'},
+    {"output", required_argument, nullptr, 'O'},
+    {"level", required_argument, nullptr, 'L'},
+    {nullptr, 0, nullptr, 0}};
+
+// Builds the workloads.
+static std::vector<workload> make_workloads()
+{
+    std::vector<workload> workloads;
+
+    workloads.push_back({"small", {"prg", "-v", "-o", "output.txt", "--verbose", "--level=3", "input.txt"}});
+
+    workload huge = {"huge_argv", {"prg"}};
+    for (int i = 0; i < 100000; i++)
+    {
+        if (i % 4 == 0)
+            huge.tokens.push_back("--verbose");
+        else if (i % 4 == 1)
+            huge.tokens.push_back("--level=" + std::to_string(i));
+        else
+            huge.tokens.push_back("input-file-" + std::to_string(i) + ".txt");
+    }
+    huge.tokens.push_back("--output=output.txt");
+    workloads.push_back(huge);
+
+    workload clusters = {"short_clusters", {"prg"}};
+    for (int i = 0; i < 10000; i++)
+        clusters.tokens.push_back(i % 2 == 0 ? "-abcdefg" : "-hijklmnv");
+    clusters.tokens.push_back("-o");
+    clusters.tokens.push_back("output.txt");
+    workloads.push_back(clusters);
+
+    return workloads;
+}
+
+// Parses with argh.
+static answers parse_argh(int argc, char *argv[])
+{
+    argh::argh args(argc, argv);
+    args.mark_parameter("-o");
+    answers result = {0, 0, 0};
+    for (const char *name : {"-a", "-b", "-c", "-d", "-e", "-f", "-g", "-h", "-i", "-j", "-k", "-l", "-m", "-n", "-v",
+                             "--verbose", "--level"})
+        result.flags += args[name];
+    std::string output = args("-o");
+    if (output.empty())
+        output = args("--output");
+    result.output_length = output.length();
+    result.positionals = args.size();
+    return result;
+}
+
+// Parses with getopt_long.
+static answers parse_getopt_long(int argc, char *argv[])
+{
+    // getopt_long permutes argv, so it works on its own copy of the pointers.
+    std::vector<char *> permuted(argv, argv + argc);
+    bool seen[128] = {};
+    answers result = {0, 0, 0};
+
+    optind = 0;
+    opterr = 0;
+    int code;
+    while ((code = getopt_long(argc, permuted.data(), short_options, long_options, nullptr)) != -1)
+    {
+        if (code == 'o' || code == 'O')
+            result.output_length = std::strlen(optarg);
+        if (code > 0 && code < 128 && code != 'o' && code != 'O')
+            seen[code] = true;
+    }
+    for (bool flag : seen)
+        result.flags += flag;
+    result.positionals = argc - optind;
+    return result;
+}
+
+// Parses with a minimal hand-written loop that knows the options ahead of time.
+static answers parse_by_hand(int argc, char *argv[])
+{
+    bool seen[128] = {};
+    answers result = {0, 0, 0};
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (arg[0] != '-' || arg[1] == '\0')
+        {
+            result.positionals++;
+        }
+        else if (arg[1] == '-')
+        {
+            if (std::strcmp(arg, "--verbose") == 0)
+                seen['V'] = true;
+            else if (std::strncmp(arg, "--level", 7) == 0)
+                seen['L'] = true;
+            else if (std::strncmp(arg, "--output=", 9) == 0)
+                result.output_length = std::strlen(arg + 9);
+        }
+        else
+        {
+            for (const char *letter = arg + 1; *letter != '\0'; letter++)
+            {
+                if (*letter == 'o')
+                {
+                    if (letter[1] == '\0' && i + 1 < argc)
+                        result.output_length = std::strlen(argv[++i]);
+                    break;
+                }
+                seen[(unsigned char)*letter & 127] = true;
+            }
+        }
+    }
+    for (bool flag : seen)
+        result.flags += flag;
+    return result;
+}
+
+// A measurement of one parser on one workload.
+struct measurement
+{
+    answers found;
+    long int parses;
+    double seconds;
+    double allocations_per_parse;
+    double bytes_per_parse;
+    long int peak_rss_growth_kb;
+};
+
+// Returns the peak RSS of the process so far.
+//
+//   * return (long int) - The peak RSS, in kilobytes.
+static long int peak_rss_kb()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Runs a parser on a workload in a child process, and collects the measurement through a pipe.
+//
+//   * answers (*parse)(int, char *[]) - The parser.
+//   * workload &load                  - The workload.
+//
+//   * return (measurement) - The measurement.
+static measurement measure(answers (*parse)(int, char *[]), workload &load)
+{
+    measurement result = {};
+    int channel[2];
+    if (pipe(channel) != 0)
+        return result;
+
+    pid_t child = fork();
+    if (child == 0)
+    {
+        long int baseline_kb = peak_rss_kb();
+        std::vector<char *> argv;
+        for (std::string &token : load.tokens)
+            argv.push_back(token.data());
+
+        // One parse to warm up, and to count the allocations of a single parse.
+        argh::alloc_counter counter;
+        result.found = parse(argv.size(), argv.data());
+        result.allocations_per_parse = counter.allocations();
+        result.bytes_per_parse = counter.bytes();
+
+        auto start = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed(0);
+        while (elapsed.count() < 0.25)
+        {
+            parse(argv.size(), argv.data());
+            result.parses++;
+            elapsed = std::chrono::steady_clock::now() - start;
+        }
+        result.seconds = elapsed.count();
+
+        result.peak_rss_growth_kb = peak_rss_kb() - baseline_kb;
+
+        (void)!write(channel[1], &result, sizeof(result));
+        _exit(0);
+    }
+
+    close(channel[1]);
+    if (read(channel[0], &result, sizeof(result)) != sizeof(result))
+        result = {};
+    close(channel[0]);
+    waitpid(child, nullptr, 0);
+    return result;
+}
+
+int main()
+{
+    struct parser
+    {
+        const char *name;
+        answers (*parse)(int, char *[]);
+    };
+    const parser parsers[] = {
+        {"getopt_long", parse_getopt_long},
+        {"argh", parse_argh},
+        {"hand_rolled", parse_by_hand}};
+
+    bool agreed = true;
+    for (workload &load : make_workloads())
+    {
+        double getopt_rate = 0;
+        answers expected = {};
+        for (const parser &candidate : parsers)
+        {
+            measurement result = measure(candidate.parse, load);
+            if (candidate.parse == parsers[0].parse)
+                expected = result.found;
+            if (result.found.flags != expected.flags || result.found.output_length != expected.output_length ||
+                result.found.positionals != expected.positionals)
+            {
+                std::fprintf(stderr, "%s disagrees with %s on %s: %d flags, output of %d, %d positionals\n",
+                             candidate.name, parsers[0].name, load.name.c_str(), result.found.flags,
+                             result.found.output_length, result.found.positionals);
+                agreed = false;
+            }
+            double rate = result.seconds > 0 ? result.parses * load.tokens.size() / result.seconds : 0;
+            if (std::strcmp(candidate.name, "getopt_long") == 0)
+                getopt_rate = rate;
+
+            std::printf("{\"workload\":\"%s\",\"parser\":\"%s\",\"tokens\":%zu,\"parses\":%ld,"
+                        "\"tokens_per_second\":%.0f,\"allocations_per_parse\":%.0f,\"bytes_per_parse\":%.0f,"
+                        "\"peak_rss_growth_kb\":%ld,\"ratio_to_getopt_long\":%.3f}\n",
+                        load.name.c_str(), candidate.name, load.tokens.size(), result.parses,
+                        rate, result.allocations_per_parse, result.bytes_per_parse,
+                        result.peak_rss_growth_kb, getopt_rate > 0 ? rate / getopt_rate : 0.0);
+        }
+    }
+    return agreed ? 0 : 1;
+}
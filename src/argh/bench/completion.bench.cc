@@ -0,0 +1,74 @@
+// src/argh/bench/completion.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the latency benchmarks for the argh completion utility.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/completion.h"
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+// Registers n long options that share long common prefixes.
+static void make_options(argh::options &opts, int n)
+{
+    for (int i = 0; i < n; i++)
+        opts.add("--option-" + std::to_string(i));
+}
+
+// Completes a word that narrows the options down to a handful of candidates.
+static void BM_complete(benchmark::State &state)
+{
+    argh::options opts;
+    make_options(opts, state.range(0));
+    argh::completer engine(opts);
+
+    std::vector<std::string_view> words = {"prg", "-v", "file.txt", "--option-12"};
+    std::vector<std::string_view> candidates;
+    for (auto _ : state)
+    {
+        candidates.clear();
+        engine.complete(words, candidates);
+        benchmark::DoNotOptimize(candidates.data());
+    }
+}
+BENCHMARK(BM_complete)->RangeMultiplier(8)->Range(8, 32768);
+
+// Measures the full round trip to a completion server, as a shell completion function sees it.
+static void BM_server_round_trip(benchmark::State &state)
+{
+    argh::options opts;
+    make_options(opts, state.range(0));
+    argh::completer engine(opts);
+
+    std::string path = "/tmp/argh_completion_bench." + std::to_string(getpid()) + ".sock";
+    argh::completion_server server(engine, path);
+    if (!server.listen())
+    {
+        state.SkipWithError("Could not listen on the completion socket.");
+        return;
+    }
+    std::thread serving([&server]() { server.serve(); });
+
+    std::string response;
+    for (auto _ : state)
+    {
+        argh::query_completion_server(path, "prg\t-v\tfile.txt\t--option-12", response);
+        benchmark::DoNotOptimize(response.data());
+    }
+
+    server.stop();
+    serving.join();
+}
+BENCHMARK(BM_server_round_trip)->RangeMultiplier(8)->Range(8, 32768)->Unit(benchmark::kMicrosecond);
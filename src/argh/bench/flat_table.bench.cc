@@ -0,0 +1,77 @@
+// src/argh/bench/flat_table.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the benchmarks for the argh flat_table class.
+// They compare it with std::unordered_map on inserts, as a parse does them,
+// and on lookups, as a query loop does them.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/flat_table.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+// Inserts n ids, as a parse with n distinct options does.
+static void BM_flat_table_insert(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        argh::flat_table table;
+        for (std::uint32_t id = 1; id <= state.range(0); id++)
+            table.try_emplace(id, id);
+        benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_flat_table_insert)->RangeMultiplier(8)->Range(32, 32768);
+
+// Inserts n ids into a std::unordered_map, for comparison.
+static void BM_unordered_map_insert(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::unordered_map<std::uint32_t, std::uint32_t> table;
+        for (std::uint32_t id = 1; id <= state.range(0); id++)
+            table.try_emplace(id, id);
+        benchmark::DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_unordered_map_insert)->RangeMultiplier(8)->Range(32, 32768);
+
+// Looks up every id of a table of n, and as many absent ids.
+static void BM_flat_table_lookup(benchmark::State &state)
+{
+    argh::flat_table table;
+    for (std::uint32_t id = 1; id <= state.range(0); id++)
+        table.try_emplace(id, id);
+    for (auto _ : state)
+    {
+        for (std::uint32_t id = 1; id <= 2 * state.range(0); id++)
+            benchmark::DoNotOptimize(table.find(id));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_flat_table_lookup)->RangeMultiplier(8)->Range(32, 32768);
+
+// Looks up every id of a std::unordered_map of n, and as many absent ids, for comparison.
+static void BM_unordered_map_lookup(benchmark::State &state)
+{
+    std::unordered_map<std::uint32_t, std::uint32_t> table;
+    for (std::uint32_t id = 1; id <= state.range(0); id++)
+        table.try_emplace(id, id);
+    for (auto _ : state)
+    {
+        for (std::uint32_t id = 1; id <= 2 * state.range(0); id++)
+            benchmark::DoNotOptimize(table.find(id));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_unordered_map_lookup)->RangeMultiplier(8)->Range(32, 32768);
@@ -0,0 +1,163 @@
+// src/argh/bench/perf_counters.cc
+// v0.1.1
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the perf_counters class.
+// For use in the argh benchmarks.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "perf_counters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace argh
+{
+    // The names of the events, as they are reported.
+    static const char *const event_names[perf_counters::event_count] = {
+        "cycles/token", "instructions/token", "branch-misses/token", "L1D-misses/token"};
+
+#if defined(__linux__)
+    // Opens a single counter for the current thread.
+    //
+    //   * unsigned int type         - The type of the event.
+    //   * unsigned long long config - The event.
+    //   * int group                 - The group leader, or -1 to open a new group.
+    //
+    //   * return (int) - The file descriptor of the counter, or -1.
+    static int open_counter(unsigned int type, unsigned long long config, int group)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = group == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+    }
+#endif
+
+    // The zero-argument constructor that opens the counters, stopped.
+    perf_counters::perf_counters()
+    {
+        this->leader = -1;
+        for (int &fd : this->fds)
+            fd = -1;
+
+#if defined(__linux__)
+        this->fds[cycles] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+        this->leader = this->fds[cycles];
+        if (this->leader == -1)
+            return;
+
+        this->fds[instructions] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, this->leader);
+        this->fds[branch_misses] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, this->leader);
+        this->fds[l1d_misses] = open_counter(PERF_TYPE_HW_CACHE,
+                                             PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                                 | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                                             this->leader);
+#endif
+    }
+
+    // The destructor closes the counters.
+    perf_counters::~perf_counters()
+    {
+#if defined(__linux__)
+        for (int fd : this->fds)
+        {
+            if (fd != -1)
+                close(fd);
+        }
+#endif
+    }
+
+    // Returns whether any counter could be opened.
+    //
+    //   * return (bool) - True if at least one counter is available.
+    bool perf_counters::available() const
+    {
+        return this->leader != -1;
+    }
+
+    // Resets the counters and starts counting.
+    void perf_counters::start()
+    {
+#if defined(__linux__)
+        if (this->leader == -1)
+            return;
+        ioctl(this->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(this->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    // Stops counting.
+    void perf_counters::stop()
+    {
+#if defined(__linux__)
+        if (this->leader == -1)
+            return;
+        ioctl(this->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    // Returns the count of an event since the last start.
+    //
+    //   * event which - The event.
+    //
+    //   * return (long int) - The count, or -1 if the event is not available.
+    long int perf_counters::read(event which) const
+    {
+#if defined(__linux__)
+        long long unsigned int count;
+        if (this->fds[which] != -1 && ::read(this->fds[which], &count, sizeof(count)) == sizeof(count))
+            return count;
+#endif
+        (void)which;
+        return -1;
+    }
+
+    // The two-argument constructor that starts counting.
+    //
+    //   * benchmark::State &state - The state of the benchmark.
+    //   * double tokens           - The number of tokens processed per iteration.
+    perf_scope::perf_scope(benchmark::State &state, double tokens) : state(state)
+    {
+        this->tokens = tokens;
+        if (std::getenv("ARGH_PERF_COUNTERS") == nullptr)
+            return;
+
+        this->counters.emplace();
+        this->counters->start();
+    }
+
+    // The destructor stops counting and reports the counters.
+    perf_scope::~perf_scope()
+    {
+        if (!this->counters)
+            return;
+        this->counters->stop();
+
+        double total = this->tokens * this->state.iterations();
+        for (int which = 0; which < perf_counters::event_count && total > 0; which++)
+        {
+            long int count = this->counters->read((perf_counters::event)which);
+            if (count >= 0)
+                this->state.counters[event_names[which]] = count / total;
+        }
+    }
+}
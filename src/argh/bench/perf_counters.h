@@ -0,0 +1,114 @@
+// src/argh/bench/perf_counters.h
+// v0.1.1
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the perf_counters headers.
+// For use in the argh benchmarks.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+namespace argh
+{
+    // The argh::perf_counters class reads the Linux hardware performance counters
+    // (cycles, instructions, branch misses, and L1 data cache misses) of the current thread.
+    //
+    // Counters that can't be opened, for instance in a container without access
+    // to perf_event_open, are left out; if none can be opened, nothing is reported.
+    class perf_counters
+    {
+        public:
+        // The events that are counted.
+        enum event
+        {
+            cycles,
+            instructions,
+            branch_misses,
+            l1d_misses,
+            event_count
+        };
+
+        // The zero-argument constructor that opens the counters, stopped.
+        perf_counters();
+
+        // The destructor closes the counters.
+        ~perf_counters();
+
+        perf_counters(const perf_counters &) = delete;
+        perf_counters &operator=(const perf_counters &) = delete;
+
+        // Returns whether any counter could be opened.
+        //
+        //   * return (bool) - True if at least one counter is available.
+        bool available() const;
+
+        // Resets the counters and starts counting.
+        void start();
+
+        // Stops counting.
+        void stop();
+
+        // Returns the count of an event since the last start.
+        //
+        //   * event which - The event.
+        //
+        //   * return (long int) - The count, or -1 if the event is not available.
+        long int read(event which) const;
+
+        private:
+        // The file descriptors of the counters, or -1 for those that are not available.
+        int fds[event_count];
+
+        // The file descriptor of the group leader, or -1.
+        int leader;
+    };
+
+    // The argh::perf_scope class counts the benchmark loop that follows its construction,
+    // and reports the counters per token when it goes out of scope.
+    //
+    //    static void BM_parse(benchmark::State &state)
+    //    {
+    //        ...
+    //        argh::perf_scope perf(state, argv.size());
+    //        for (auto _ : state)
+    //        {
+    //            ...
+    //        }
+    //    }
+    //
+    // The counters are only read when the ARGH_PERF_COUNTERS environment variable is set,
+    // so that the default run measures time alone.
+    class perf_scope
+    {
+        public:
+        // The two-argument constructor that starts counting.
+        //
+        //   * benchmark::State &state - The state of the benchmark.
+        //   * double tokens           - The number of tokens processed per iteration.
+        perf_scope(benchmark::State &state, double tokens);
+
+        // The destructor stops counting and reports the counters.
+        ~perf_scope();
+
+        private:
+        // The state of the benchmark.
+        benchmark::State &state;
+
+        // The number of tokens processed per iteration.
+        double tokens;
+
+        // The counters, or nothing when they are not requested.
+        std::optional<perf_counters> counters;
+    };
+}
+
+#endif
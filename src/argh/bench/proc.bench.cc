@@ -0,0 +1,145 @@
+// src/argh/bench/proc.bench.cc
+// v0.1.1
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the benchmarks for the argh process table scanner.
+// It scans a synthetic /proc tree, and compares the scanner against reading
+// and parsing each command line with the argh class.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/argh.h"
+#include "argh/options.h"
+#include "argh/proc.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// The synthetic trees, by process count. They are removed when the benchmarks exit.
+static std::map<int, std::string> trees;
+
+static void remove_trees()
+{
+    for (const auto &[count, root] : trees)
+        std::filesystem::remove_all(root);
+}
+
+// Returns a directory laid out like /proc, with n processes.
+// A third are kernel threads, with empty command lines; the rest are a mix of
+// JVMs, daemons with configuration files, and shells.
+static const std::string &make_tree(int n)
+{
+    auto found = trees.find(n);
+    if (found != trees.end())
+        return found->second;
+    if (trees.empty())
+        std::atexit(remove_trees);
+
+    char path[] = "/tmp/argh_proc_bench_XXXXXX";
+    std::string root = mkdtemp(path);
+    for (int pid = 1; pid <= n; pid++)
+    {
+        // The literals separate the arguments with '\1', since '\0' would end them.
+        std::string cmdline;
+        switch (pid % 6)
+        {
+        case 0:
+        case 3:
+            break;
+        case 1:
+            cmdline = "/usr/bin/java\1-Xms512m\1-Xmx" + std::to_string(pid % 16 + 1) + "g\1-Dapp.name=worker\1"
+                      "-cp\1/opt/app/lib/*\1com.example.Main\1--config\1/etc/app/" + std::to_string(pid) + ".yaml\1";
+            break;
+        case 2:
+            cmdline = "/usr/sbin/daemon\1--config=/etc/daemon.conf\1--verbose\1-p\1" + std::to_string(8000 + pid % 1000) +
+                      "\1--log-level=info\1";
+            break;
+        case 4:
+            cmdline = "-bash\1";
+            break;
+        default:
+            cmdline = "python3\1-u\1/srv/jobs/run.py\1--workers\1" + std::to_string(pid % 32) + "\1--dry-run\1";
+            break;
+        }
+        for (char &c : cmdline)
+        {
+            if (c == '\1')
+                c = '\0';
+        }
+        std::string dir = root + "/" + std::to_string(pid);
+        std::filesystem::create_directory(dir);
+        std::ofstream(dir + "/cmdline", std::ios::binary) << cmdline;
+    }
+    return trees[n] = root;
+}
+
+// The schema that the benchmarks look for.
+static argh::options make_schema()
+{
+    argh::options schema;
+    schema.add("--config", nullptr, "FILE");
+    schema.add("--verbose");
+    schema.add("--workers", nullptr, "N");
+    schema.add("-Xmx", nullptr, "SIZE");
+    schema.add("-cp", nullptr, "PATH");
+    schema.add("-p", nullptr, "PORT");
+    return schema;
+}
+
+// Scans the tree with the process scanner.
+// The first argument is the number of processes, and the second the number of threads.
+static void BM_scan(benchmark::State &state)
+{
+    const std::string &root = make_tree(state.range(0));
+    argh::options schema = make_schema();
+    argh::process_scanner scanner(schema, state.range(1), root);
+    argh::process_table table;
+    for (auto _ : state)
+    {
+        scanner.scan(table);
+        benchmark::DoNotOptimize(table.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_scan)->ArgsProduct({{1000, 10000, 50000}, {1, 2, 4, 8}})->UseRealTime();
+
+// Reads each command line into a new string and parses it with the argh class, on one thread.
+static void BM_scan_argh(benchmark::State &state)
+{
+    const std::string &root = make_tree(state.range(0));
+    argh::options schema = make_schema();
+    for (auto _ : state)
+    {
+        long int found = 0;
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(root))
+        {
+            std::ifstream in(entry.path() / "cmdline", std::ios::binary);
+            std::string cmdline((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            std::vector<std::string> arguments;
+            for (std::size_t begin = 0; begin < cmdline.length();)
+            {
+                std::size_t end = cmdline.find('\0', begin);
+                if (end == std::string::npos)
+                    end = cmdline.length();
+                arguments.push_back(cmdline.substr(begin, end - begin));
+                begin = end + 1;
+            }
+            argh::argh args(std::move(arguments), schema);
+            found += args["--config"];
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_scan_argh)->Arg(1000)->Arg(10000)->Arg(50000)->UseRealTime();
@@ -0,0 +1,62 @@
+// src/argh/bench/query.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the query-heavy benchmarks for the argh library.
+// It is built twice, against //argh and against //argh:argh_header_only,
+// to measure what inlining the accessors into the caller is worth.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/argh.h"
+
+#include <string>
+#include <vector>
+
+// Builds a short argv vector, as a program might see it: a few flags,
+// a parameter, and n short positional arguments.
+static std::vector<std::string> make_argv(int n)
+{
+    std::vector<std::string> argv = {"-v", "--color", "-o", "out.txt"};
+    for (int i = 0; i < n; i++)
+        argv.push_back("f" + std::to_string(i));
+    return argv;
+}
+
+// Sums the lengths of every positional argument, as a loop over the input files would.
+static void BM_loop_positionals(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0));
+    argh::argh args(argv.size(), argv.data());
+    args.mark_parameter("-o");
+    for (auto _ : state)
+    {
+        long unsigned int total = 0;
+        for (int i = 0; i < args.size(); i++)
+            total += args[i].length();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * args.size());
+}
+BENCHMARK(BM_loop_positionals)->RangeMultiplier(8)->Range(8, 4096);
+
+// Checks the same few options on every iteration, as an inner loop that re-reads its settings would.
+static void BM_loop_options(benchmark::State &state)
+{
+    std::vector<std::string> argv = make_argv(state.range(0));
+    argh::argh args(argv.size(), argv.data());
+    const std::string verbose = "-v", color = "--color", quiet = "-q", output = "-o";
+    for (auto _ : state)
+    {
+        int enabled = args[verbose] + args[color] + args[quiet];
+        benchmark::DoNotOptimize(enabled);
+        benchmark::DoNotOptimize(args(output));
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_loop_options)->Arg(8)->Arg(4096);
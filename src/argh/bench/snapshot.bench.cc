@@ -0,0 +1,161 @@
+// src/argh/bench/snapshot.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the benchmark of sharing parsed arguments with forked workers.
+//
+// The master parses a large command line, then forks workers that each answer the same
+// queries: from the argh instance as parsed, from a copy whose parameters the master
+// marked before forking, or from a snapshot of that copy. Each worker
+// reports how many kilobytes it dirtied (and so no longer shares with the master) while
+// querying, and how fast it queried. The results are printed as one JSON object per line:
+//
+//    {"store":"snapshot","workers":8,"tokens":...,"region_kb":...,"private_dirty_kb_per_worker":...,
+//     "queries_per_second_per_worker":...}
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "argh/argh.h"
+#include "argh/snapshot.h"
+#include "argh/tests/memory_usage.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// What a worker reports.
+struct measurement
+{
+    long int private_dirty_kb;
+    long int queries;
+    double seconds;
+};
+
+// Keeps the answers from being optimized away.
+static volatile long int sink;
+
+// Answers every query once: each parameter, each flag, and each positional argument.
+//
+//   * store &options                        - The argh instance or the snapshot.
+//   * const std::vector<std::string> &names - The names of the parameters and flags.
+//
+//   * return (long int) - The number of queries answered.
+template <typename store>
+static long int query(store &options, const std::vector<std::string> &names)
+{
+    long int found = 0;
+    for (const std::string &name : names)
+    {
+        found += options.parameter_value(name).length();
+        found += options.has_flag(name);
+    }
+    for (int i = 0; i < options.size(); i++)
+        found += options.positional(i).length();
+    sink = found;
+    return names.size() * 2 + options.size();
+}
+
+// Forks workers that query a store, and averages what they report.
+//
+//   * store &options                        - The argh instance or the snapshot.
+//   * const std::vector<std::string> &names - The names of the parameters and flags.
+//   * int workers                           - The number of workers.
+//
+//   * return (measurement) - The average measurement.
+template <typename store>
+static measurement measure(store &options, const std::vector<std::string> &names, int workers)
+{
+    measurement total = {0, 0, 0};
+    std::vector<int> channels;
+    std::vector<pid_t> children;
+    for (int i = 0; i < workers; i++)
+    {
+        int channel[2];
+        if (pipe(channel) != 0)
+            break;
+        pid_t child = fork();
+        if (child == 0)
+        {
+            measurement result = {0, 0, 0};
+            argh::memory_usage before = argh::measure_process();
+            auto start = std::chrono::steady_clock::now();
+            result.queries = query(options, names);
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            argh::memory_usage after = argh::measure_process();
+            result.private_dirty_kb = after.private_dirty_kb - before.private_dirty_kb;
+            (void)!write(channel[1], &result, sizeof(result));
+            _exit(0);
+        }
+        close(channel[1]);
+        channels.push_back(channel[0]);
+        children.push_back(child);
+    }
+
+    for (std::size_t i = 0; i < children.size(); i++)
+    {
+        measurement result;
+        if (read(channels[i], &result, sizeof(result)) == sizeof(result))
+        {
+            total.private_dirty_kb += result.private_dirty_kb;
+            total.queries += result.queries;
+            total.seconds += result.seconds;
+        }
+        close(channels[i]);
+        waitpid(children[i], nullptr, 0);
+    }
+    if (!children.empty())
+        total.private_dirty_kb /= children.size();
+    return total;
+}
+
+int main()
+{
+    // A large configuration: parameters given with '=', parameters followed by their values, and files.
+    std::vector<std::string> argv;
+    std::vector<std::string> names;
+    for (int i = 0; i < 30000; i++)
+    {
+        argv.push_back("--set-" + std::to_string(i) + "=" + std::to_string(i * 7));
+        argv.push_back("--path-" + std::to_string(i));
+        argv.push_back("/srv/data/shard-" + std::to_string(i));
+        argv.push_back("input-file-" + std::to_string(i) + ".txt");
+        names.push_back("--set-" + std::to_string(i));
+        names.push_back("--path-" + std::to_string(i));
+    }
+    std::size_t tokens = argv.size();
+    argh::argh parsed(std::move(argv));
+    argh::argh marked(parsed);
+    for (int i = 0; i < 30000; i++)
+        marked.mark_parameter("--path-" + std::to_string(i));
+
+    argh::snapshot published;
+    if (!published.publish(marked))
+    {
+        std::fprintf(stderr, "could not publish the snapshot\n");
+        return 1;
+    }
+
+    for (int workers : {1, 8, 32})
+    {
+        measurement from_parsed = measure(parsed, names, workers);
+        measurement from_marked = measure(marked, names, workers);
+        measurement from_snapshot = measure(published, names, workers);
+        for (auto [store, result] : {std::pair{"argh", from_parsed}, std::pair{"argh_marked", from_marked},
+                                     std::pair{"snapshot", from_snapshot}})
+        {
+            std::printf("{\"store\":\"%s\",\"workers\":%d,\"tokens\":%zu,\"region_kb\":%zu,"
+                        "\"private_dirty_kb_per_worker\":%ld,\"queries_per_second_per_worker\":%.0f}\n",
+                        store, workers, tokens, published.bytes() / 1024, result.private_dirty_kb,
+                        result.seconds > 0 ? result.queries / result.seconds : 0.0);
+        }
+    }
+    return 0;
+}
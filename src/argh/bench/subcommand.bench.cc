@@ -0,0 +1,91 @@
+// src/argh/bench/subcommand.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the benchmarks for the argh subcommand utility.
+// It compares trie dispatch against a chain of string compares on args[0].
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/subcommand.h"
+
+#include <string>
+#include <vector>
+
+// Builds the names of n subcommands that share long common prefixes,
+// which is the worst case for a chain of string compares.
+static std::vector<std::string> make_names(int n)
+{
+    std::vector<std::string> names;
+    for (int i = 0; i < n; i++)
+        names.push_back("subcommand-" + std::to_string(i));
+    return names;
+}
+
+// Resolves every subcommand name through the trie.
+static void BM_trie_find(benchmark::State &state)
+{
+    std::vector<std::string> names = make_names(state.range(0));
+    argh::command_tree tree;
+    for (const std::string &name : names)
+        tree.add(name);
+
+    for (auto _ : state)
+    {
+        for (const std::string &name : names)
+            benchmark::DoNotOptimize(tree.find(argh::command_tree::root, name));
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_trie_find)->RangeMultiplier(4)->Range(4, 1024);
+
+// Resolves every subcommand name through a chain of string compares.
+static void BM_compare_chain(benchmark::State &state)
+{
+    std::vector<std::string> names = make_names(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (const std::string &name : names)
+        {
+            int found = -1;
+            for (long unsigned int i = 0; i < names.size(); i++)
+            {
+                if (names[i] == name)
+                {
+                    found = i;
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(found);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_compare_chain)->RangeMultiplier(4)->Range(4, 1024);
+
+// Dispatches a full three-level command line among n subcommands per level.
+static void BM_dispatch(benchmark::State &state)
+{
+    std::vector<std::string> names = make_names(state.range(0));
+    argh::command_tree tree;
+    int last = -1;
+    for (const std::string &name : names)
+        last = tree.add(name);
+    for (const std::string &name : names)
+        tree.add(name, last);
+
+    std::vector<std::string> tokens = {"prg", "-v", names.back(), "--output=out.txt", names.back(), "-abc", "file.txt"};
+    std::vector<char *> argv;
+    for (std::string &token : tokens)
+        argv.push_back(token.data());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(tree.dispatch(argv.size(), argv.data()));
+}
+BENCHMARK(BM_dispatch)->RangeMultiplier(4)->Range(4, 1024);
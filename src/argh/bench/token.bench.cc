@@ -0,0 +1,99 @@
+// src/argh/bench/token.bench.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the benchmarks for the argh token classifier.
+// It compares the state machine against the chain of string compares that it replaced.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/bench/perf_counters.h"
+#include "argh/token.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// A realistic mix of tokens, shuffled so that the branch predictor can't learn the order.
+static std::vector<std::string> make_tokens()
+{
+    std::vector<std::string> kinds = {
+        "-v", "-abc", "--verbose", "--output=output.txt", "--output", "output.txt",
+        "input-file.txt", "-", "-o", "/usr/local/share/data.csv", "--log-level=debug", "-j8"};
+    std::vector<std::string> tokens;
+    for (int i = 0; i < 4096; i++)
+        tokens.push_back(kinds[i % kinds.size()]);
+    std::shuffle(tokens.begin(), tokens.end(), std::mt19937(42));
+    return tokens;
+}
+
+// The classification logic of argh v0.4, kept here for comparison.
+// It returns the same kinds and offsets as argh::classify.
+static argh::token classify_chain(std::string arg)
+{
+    unsigned int length = arg.length();
+    if (arg.length() == 0)
+        return {argh::token_kind::empty, length, length + 1};
+    if (arg == "-")
+        return {argh::token_kind::dash, length, length + 1};
+    if (arg == "--")
+        return {argh::token_kind::double_dash, length, length + 1};
+    if (arg.length() < 2 || arg[0] != '-')
+        return {argh::token_kind::positional, length, length + 1};
+    if (arg.find('=') != std::string::npos)
+    {
+        std::string key = arg.substr(0, arg.find('='));
+        std::string value = arg.substr(arg.find('=') + 1);
+        bool is_long = arg.length() >= 2 && arg.substr(0, 2) == "--";
+        return {is_long ? argh::token_kind::long_with_value : argh::token_kind::short_with_value,
+                (unsigned int)key.length(), (unsigned int)key.length() + 1};
+    }
+    if (arg.length() >= 2 && arg.substr(0, 2) == "--")
+        return {argh::token_kind::long_option, length, length + 1};
+    return {argh::token_kind::short_cluster, length, length + 1};
+}
+
+// Classifies the token mix with the state machine.
+// Run with ARGH_PERF_COUNTERS set to compare branch misses per token.
+static void BM_classify(benchmark::State &state)
+{
+    std::vector<std::string> tokens = make_tokens();
+    long int bytes = 0;
+    for (const std::string &token : tokens)
+        bytes += token.length();
+
+    argh::perf_scope perf(state, tokens.size());
+    for (auto _ : state)
+    {
+        for (const std::string &token : tokens)
+            benchmark::DoNotOptimize(argh::classify(token));
+    }
+    state.SetItemsProcessed(state.iterations() * tokens.size());
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(BM_classify);
+
+// Classifies the token mix with the chain of string compares.
+static void BM_classify_chain(benchmark::State &state)
+{
+    std::vector<std::string> tokens = make_tokens();
+    long int bytes = 0;
+    for (const std::string &token : tokens)
+        bytes += token.length();
+
+    argh::perf_scope perf(state, tokens.size());
+    for (auto _ : state)
+    {
+        for (const std::string &token : tokens)
+            benchmark::DoNotOptimize(classify_chain(token));
+    }
+    state.SetItemsProcessed(state.iterations() * tokens.size());
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(BM_classify_chain);
@@ -0,0 +1,92 @@
+// src/argh/bench/utf8.bench.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the benchmarks for the argh text validation.
+// It compares each implementation of check_text, and measures what
+// validation adds to a parse.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <benchmark/benchmark.h>
+
+#include "argh/argh.h"
+#include "argh/options.h"
+#include "argh/utf8.h"
+
+#include <string>
+#include <vector>
+
+// Builds n arguments of a given length, mostly ASCII with some accented and CJK characters.
+static std::vector<std::string> make_arguments(int n, int length)
+{
+    const std::string pieces[] = {"--name=", "caf\xc3\xa9", "data", "\xe6\x97\xa5\xe6\x9c\xac", "-", "x"};
+    std::vector<std::string> arguments;
+    for (int i = 0; i < n; i++)
+    {
+        std::string argument;
+        for (int k = i; (int)argument.length() < length; k++)
+            argument += pieces[k % 6];
+        arguments.push_back(argument);
+    }
+    return arguments;
+}
+
+// Checks every argument with one implementation.
+static void check_arguments(benchmark::State &state, argh::text_checker checker)
+{
+    if (!argh::text_checker_supported(checker))
+    {
+        state.SkipWithError("not supported by this processor");
+        return;
+    }
+    std::vector<std::string> arguments = make_arguments(256, state.range(0));
+    for (auto _ : state)
+    {
+        for (const std::string &argument : arguments)
+            benchmark::DoNotOptimize(argh::check_text(argument, checker));
+    }
+    state.SetBytesProcessed(state.iterations() * arguments.size() * state.range(0));
+}
+
+static void BM_check_scalar(benchmark::State &state)
+{
+    check_arguments(state, argh::text_checker::scalar);
+}
+BENCHMARK(BM_check_scalar)->Arg(12)->Arg(40)->Arg(4096);
+
+static void BM_check_sse4(benchmark::State &state)
+{
+    check_arguments(state, argh::text_checker::sse4);
+}
+BENCHMARK(BM_check_sse4)->Arg(12)->Arg(40)->Arg(4096);
+
+static void BM_check_avx2(benchmark::State &state)
+{
+    check_arguments(state, argh::text_checker::avx2);
+}
+BENCHMARK(BM_check_avx2)->Arg(12)->Arg(40)->Arg(4096);
+
+static void BM_check_best(benchmark::State &state)
+{
+    check_arguments(state, argh::text_checker::best);
+}
+BENCHMARK(BM_check_best)->Arg(12)->Arg(40)->Arg(4096);
+
+// Parses the same arguments with and without validation.
+static void BM_parse(benchmark::State &state)
+{
+    std::vector<std::string> arguments = make_arguments(64, 40);
+    argh::options opts;
+    opts.validate_text(state.range(0));
+    for (auto _ : state)
+    {
+        argh::argh args(arguments.size(), arguments.data(), opts);
+        benchmark::DoNotOptimize(args);
+    }
+    state.SetItemsProcessed(state.iterations() * arguments.size());
+}
+BENCHMARK(BM_parse)->Arg(0)->Arg(1);
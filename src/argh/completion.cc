@@ -0,0 +1,327 @@
+// src/argh/completion.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the completion utility.
+// Use this utility to answer shell tab completion from the registered options and subcommands.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "completion.h"
+#include "options.h"
+#include "subcommand.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace argh
+{
+    // The largest request that the server accepts, in bytes.
+    static const long unsigned int max_request = 64 * 1024;
+
+    // How long the server waits on a client that stops sending or receiving, in milliseconds.
+    static const int client_timeout_ms = 1000;
+
+    // The one-argument constructor for a program without subcommands.
+    //
+    //   * const options &opts - The options of the program.
+    completer::completer(const options &opts)
+    {
+        this->tree = nullptr;
+        this->scopes.push_back(&opts);
+    }
+
+    // The one-argument constructor for a program with subcommands.
+    // Use add_options to register the options of each command.
+    //
+    //   * const command_tree &tree - The subcommands of the program.
+    completer::completer(const command_tree &tree)
+    {
+        this->tree = &tree;
+    }
+
+    // Registers the options of a command.
+    //
+    //   * const options &opts - The options of the command.
+    //   * int command         - The id of the command.
+    void completer::add_options(const options &opts, int command)
+    {
+        if ((long unsigned int)command >= this->scopes.size())
+            this->scopes.resize(command + 1, nullptr);
+        this->scopes[command] = &opts;
+    }
+
+    // Produces the completion candidates for a partially typed command line.
+    //
+    //   * const std::vector<std::string_view> &words - The words of the command line, starting
+    //                                                  with the program name and ending with
+    //                                                  the word under the cursor (possibly empty).
+    //   * std::vector<std::string_view> &candidates   - The vector to append the candidates to.
+    //                                                  They point into the registries.
+    void completer::complete(const std::vector<std::string_view> &words, std::vector<std::string_view> &candidates) const
+    {
+        if (words.empty())
+            return;
+
+        // Find the command that the cursor is in, the same way command_tree::dispatch does.
+        int current = command_tree::root;
+        for (long unsigned int i = 1; i + 1 < words.size(); i++)
+        {
+            std::string_view word = words[i];
+
+            // Nothing after a double dash can be completed.
+            if (word == "--")
+                return;
+            if (this->tree == nullptr || (word.length() > 1 && word[0] == '-'))
+                continue;
+
+            int child = this->tree->find(current, word);
+            if (child != -1)
+                current = child;
+        }
+
+        std::string_view prefix = words.back();
+        std::vector<int> ids;
+        if (prefix.length() > 0 && prefix[0] == '-')
+        {
+            if ((long unsigned int)current < this->scopes.size() && this->scopes[current] != nullptr)
+            {
+                const options &opts = *this->scopes[current];
+                opts.complete(prefix, ids);
+                for (int id : ids)
+                    candidates.push_back(opts.name(id));
+            }
+        }
+        else if (this->tree != nullptr)
+        {
+            this->tree->complete(current, prefix, ids);
+            for (int id : ids)
+                candidates.push_back(this->tree->name(id));
+        }
+    }
+
+    // The two-argument constructor.
+    //
+    //   * const completer &engine - The completer to answer requests with.
+    //   * std::string path        - The path of the Unix socket.
+    completion_server::completion_server(const completer &engine, std::string path) : engine(engine)
+    {
+        this->path = path;
+        this->listener = -1;
+        this->wake[0] = -1;
+        this->wake[1] = -1;
+    }
+
+    // The destructor closes the socket and removes it from the filesystem.
+    completion_server::~completion_server()
+    {
+        if (this->listener != -1)
+        {
+            close(this->listener);
+            unlink(this->path.c_str());
+        }
+        if (this->wake[0] != -1)
+        {
+            close(this->wake[0]);
+            close(this->wake[1]);
+        }
+    }
+
+    // Creates the socket and starts listening on it.
+    //
+    //   * return (bool) - True if the socket is ready, false otherwise.
+    bool completion_server::listen()
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (this->path.length() >= sizeof(address.sun_path))
+            return false;
+        std::memcpy(address.sun_path, this->path.c_str(), this->path.length());
+
+        if (pipe2(this->wake, O_CLOEXEC | O_NONBLOCK) != 0)
+            return false;
+
+        this->listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (this->listener == -1)
+            return false;
+
+        // A socket left behind by a previous server would make bind fail.
+        // Anything else at the path is left alone, and bind fails on it.
+        struct stat info;
+        if (lstat(this->path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode))
+            unlink(this->path.c_str());
+        if (bind(this->listener, (sockaddr *)&address, sizeof(address)) != 0 || ::listen(this->listener, 64) != 0)
+        {
+            close(this->listener);
+            this->listener = -1;
+            return false;
+        }
+        return true;
+    }
+
+    // Answers requests, one at a time, until stop is called.
+    // The byte that stop writes is drained, so that serve can be called again.
+    //
+    //   * return (bool) - True if stop was called, false if waiting for connections failed.
+    bool completion_server::serve()
+    {
+        pollfd fds[2] = {{this->listener, POLLIN, 0}, {this->wake[0], POLLIN, 0}};
+        while (true)
+        {
+            if (poll(fds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            if (fds[1].revents != 0)
+            {
+                char bytes[64];
+                while (read(this->wake[0], bytes, sizeof(bytes)) > 0)
+                    ;
+                return true;
+            }
+            if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL))
+                return false;
+            if (fds[0].revents == 0)
+                continue;
+
+            int connection = accept4(this->listener, nullptr, nullptr, SOCK_CLOEXEC);
+            if (connection == -1)
+            {
+                if (errno == EINTR || errno == EAGAIN || errno == ECONNABORTED)
+                    continue;
+                return false;
+            }
+            answer(connection);
+            close(connection);
+        }
+    }
+
+    // Makes serve return. Safe to call from another thread.
+    void completion_server::stop()
+    {
+        char byte = 0;
+        if (this->wake[1] != -1)
+            (void)!write(this->wake[1], &byte, 1);
+    }
+
+    // A helper method to answer a single request.
+    //
+    //   * int connection - The connected socket.
+    void completion_server::answer(int connection)
+    {
+        // A client that stalls only holds the server up until the timeout.
+        timeval timeout = {client_timeout_ms / 1000, (client_timeout_ms % 1000) * 1000};
+        setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        // Read up to the end of the first line.
+        std::string request;
+        char buffer[4096];
+        while (request.find('\n') == std::string::npos && request.length() < max_request)
+        {
+            ssize_t count = read(connection, buffer, sizeof(buffer));
+            if (count < 0)
+                return;
+            if (count == 0)
+                break;
+            request.append(buffer, count);
+        }
+        std::string_view line(request);
+        line = line.substr(0, line.find('\n'));
+
+        std::vector<std::string_view> words;
+        while (true)
+        {
+            long unsigned int tab = line.find('\t');
+            words.push_back(line.substr(0, tab));
+            if (tab == std::string_view::npos)
+                break;
+            line.remove_prefix(tab + 1);
+        }
+
+        std::vector<std::string_view> candidates;
+        this->engine.complete(words, candidates);
+
+        std::string response;
+        for (std::string_view candidate : candidates)
+        {
+            response.append(candidate);
+            response.push_back('\n');
+        }
+
+        long unsigned int written = 0;
+        while (written < response.length())
+        {
+            ssize_t count = send(connection, response.data() + written, response.length() - written, MSG_NOSIGNAL);
+            if (count <= 0)
+                return;
+            written += count;
+        }
+    }
+
+    // Sends one request to a completion server and waits for the response.
+    //
+    //   * const std::string &path      - The path of the Unix socket.
+    //   * std::string_view request     - The words of the command line, separated by tabs.
+    //   * std::string &response        - The string to store the response in.
+    //
+    //   * return (bool) - True if a response was received, false otherwise.
+    bool query_completion_server(const std::string &path, std::string_view request, std::string &response)
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.length() >= sizeof(address.sun_path))
+            return false;
+        std::memcpy(address.sun_path, path.c_str(), path.length());
+
+        int connection = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (connection == -1)
+            return false;
+        if (connect(connection, (sockaddr *)&address, sizeof(address)) != 0)
+        {
+            close(connection);
+            return false;
+        }
+
+        std::string line(request);
+        line.push_back('\n');
+        long unsigned int written = 0;
+        while (written < line.length())
+        {
+            ssize_t count = send(connection, line.data() + written, line.length() - written, MSG_NOSIGNAL);
+            if (count <= 0)
+            {
+                close(connection);
+                return false;
+            }
+            written += count;
+        }
+
+        response.clear();
+        char buffer[4096];
+        ssize_t count;
+        while ((count = read(connection, buffer, sizeof(buffer))) > 0)
+            response.append(buffer, count);
+
+        close(connection);
+        return count == 0;
+    }
+}
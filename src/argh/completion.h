@@ -0,0 +1,151 @@
+// src/argh/completion.h
+// v0.2.1
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the completion headers.
+// Use this utility to answer shell tab completion from the registered options and subcommands.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef COMPLETION_H
+#define COMPLETION_H
+
+#include "options.h"
+#include "subcommand.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // The argh::completer class produces tab completion candidates.
+    //
+    // Options are completed from the registry of the command that the cursor is in,
+    // and subcommands from the children of that command. Both are prefix lookups in a trie,
+    // so the cost depends on the length of the word and the number of candidates,
+    // not on the number of registered options.
+    //
+    //    argh::options opts;
+    //    opts.add("--verbose");
+    //
+    //    argh::completer engine(opts);
+    //    std::vector<std::string_view> candidates;
+    //    engine.complete({"prg", "--ve"}, candidates);
+    //    // candidates == {"--verbose"}
+    //
+    // The registries are not copied, so they must outlive the completer.
+    class completer
+    {
+        public:
+        // The one-argument constructor for a program without subcommands.
+        //
+        //   * const options &opts - The options of the program.
+        completer(const options &opts);
+
+        // The one-argument constructor for a program with subcommands.
+        // Use add_options to register the options of each command.
+        //
+        //   * const command_tree &tree - The subcommands of the program.
+        completer(const command_tree &tree);
+
+        // Registers the options of a command.
+        //
+        //   * const options &opts - The options of the command.
+        //   * int command         - The id of the command.
+        void add_options(const options &opts, int command = command_tree::root);
+
+        // Produces the completion candidates for a partially typed command line.
+        //
+        //   * const std::vector<std::string_view> &words - The words of the command line, starting
+        //                                                  with the program name and ending with
+        //                                                  the word under the cursor (possibly empty).
+        //   * std::vector<std::string_view> &candidates   - The vector to append the candidates to.
+        //                                                  They point into the registries.
+        void complete(const std::vector<std::string_view> &words, std::vector<std::string_view> &candidates) const;
+
+        private:
+        // The subcommands of the program, or nullptr if there are none.
+        const command_tree *tree;
+
+        // The options of each command, indexed by command id. Entries may be nullptr.
+        std::vector<const options *> scopes;
+    };
+
+    // The argh::completion_server class answers completion requests on a Unix socket,
+    // so that shell completion functions need not start the program on every keypress.
+    //
+    // A request is a single line holding the words of the command line separated by tabs,
+    // as described for completer::complete. The response holds one candidate per line,
+    // and the server closes the connection after it. From bash, for instance, where IFS joins
+    // the words of the request with tabs and mapfile splits the response into lines:
+    //
+    //    _prg() {
+    //        local IFS=$'\t'
+    //        mapfile -t COMPREPLY < <(printf '%s\n' "${COMP_WORDS[*]:0:COMP_CWORD+1}" | socat - UNIX-CONNECT:/tmp/prg.sock)
+    //    }
+    //    complete -F _prg prg
+    //
+    class completion_server
+    {
+        public:
+        // The two-argument constructor.
+        //
+        //   * const completer &engine - The completer to answer requests with.
+        //   * std::string path        - The path of the Unix socket.
+        completion_server(const completer &engine, std::string path);
+
+        // The destructor closes the socket and removes it from the filesystem.
+        ~completion_server();
+
+        completion_server(const completion_server &) = delete;
+        completion_server &operator=(const completion_server &) = delete;
+
+        // Creates the socket and starts listening on it.
+        // A socket left at the path by an earlier server is replaced; any other file is not.
+        //
+        //   * return (bool) - True if the socket is ready, false otherwise.
+        bool listen();
+
+        // Answers requests, one at a time, until stop is called.
+        // A client that sends or receives nothing for a second is dropped.
+        //
+        //   * return (bool) - True if stop was called, false if waiting for connections failed.
+        bool serve();
+
+        // Makes serve return. Safe to call from another thread.
+        void stop();
+
+        private:
+        // A helper method to answer a single request.
+        //
+        //   * int connection - The connected socket.
+        void answer(int connection);
+
+        // The completer to answer requests with.
+        const completer &engine;
+
+        // The path of the Unix socket.
+        std::string path;
+
+        // The listening socket, or -1.
+        int listener;
+
+        // A pipe used to wake serve up when stop is called.
+        int wake[2];
+    };
+
+    // Sends one request to a completion server and waits for the response.
+    //
+    //   * const std::string &path      - The path of the Unix socket.
+    //   * std::string_view request     - The words of the command line, separated by tabs.
+    //   * std::string &response        - The string to store the response in.
+    //
+    //   * return (bool) - True if a response was received, false otherwise.
+    bool query_completion_server(const std::string &path, std::string_view request, std::string &response);
+}
+
+#endif
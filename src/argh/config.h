@@ -0,0 +1,32 @@
+// src/argh/config.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the build configuration macros.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// With ARGH_HEADER_ONLY defined, the headers include their own implementations,
+// so that the compiler can inline the parser and its accessors into the callers.
+// This covers argh and everything it parses with: intern, options, stats, token,
+// trie and utf8. Depend on //argh:argh_header_only to get this variant. Don't mix it
+// with //argh in the same program; the two would define the same functions.
+//
+// ARGH_INLINE marks the definitions in the implementation files, which must be
+// inline when they are included in more than one translation unit. Their helpers
+// live in named namespaces rather than anonymous ones, so that every translation
+// unit shares one definition of each; in particular, one table of interned names.
+#ifdef ARGH_HEADER_ONLY
+#define ARGH_INLINE inline
+#else
+#define ARGH_INLINE
+#endif
+
+#endif
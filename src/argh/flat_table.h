@@ -0,0 +1,346 @@
+// src/argh/flat_table.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the flat_table class.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef FLAT_TABLE_H
+#define FLAT_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARGH_FLAT_TABLE_SSE2 1
+#endif
+
+namespace argh
+{
+    // An open-addressing hash table from 32-bit keys to 32-bit values, in the style of SwissTable.
+    // The keys and values sit inline in a single array of slots. Alongside it, a control byte per slot
+    // holds either "empty" or 7 bits of the key's hash, and lookups compare a whole group of
+    // 16 control bytes at once (with SSE2, where it's available) before touching any slot.
+    // There is no erase; the table only grows.
+    class flat_table
+    {
+        public:
+        // The number of slots that are probed together.
+        static constexpr std::size_t group_size = 16;
+
+        // The zero-argument constructor that creates an empty table. It does not allocate.
+        flat_table() : control(nullptr), slots(nullptr), mask(0), count(0)
+        {
+        }
+
+        // The copy constructor.
+        //
+        //   * const flat_table &other - The table to copy.
+        flat_table(const flat_table &other) : flat_table()
+        {
+            *this = other;
+        }
+
+        // The move constructor.
+        //
+        //   * flat_table &&other - The table to move from. It is left empty.
+        flat_table(flat_table &&other) noexcept
+            : control(std::exchange(other.control, nullptr)),
+              slots(std::exchange(other.slots, nullptr)),
+              mask(std::exchange(other.mask, 0)),
+              count(std::exchange(other.count, 0))
+        {
+        }
+
+        // The destructor.
+        ~flat_table()
+        {
+            release();
+        }
+
+        // The copy assignment operator.
+        //
+        //   * const flat_table &other - The table to copy.
+        flat_table &operator=(const flat_table &other)
+        {
+            if (this != &other)
+            {
+                release();
+                if (other.control != nullptr)
+                {
+                    allocate(other.mask + 1);
+                    std::memcpy(this->control, other.control, other.mask + 1);
+                    std::memcpy(this->slots, other.slots, (other.mask + 1) * sizeof(slot));
+                }
+                this->count = other.count;
+            }
+            return *this;
+        }
+
+        // The move assignment operator.
+        //
+        //   * flat_table &&other - The table to move from. It is left empty.
+        flat_table &operator=(flat_table &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                this->control = std::exchange(other.control, nullptr);
+                this->slots = std::exchange(other.slots, nullptr);
+                this->mask = std::exchange(other.mask, 0);
+                this->count = std::exchange(other.count, 0);
+            }
+            return *this;
+        }
+
+        // Inserts a key, unless it is already present.
+        //
+        //   * std::uint32_t key   - The key.
+        //   * std::uint32_t value - The value to give the key, if it is new.
+        //
+        //   * return (std::pair<std::uint32_t *, bool>) - The key's value, and whether the key was inserted.
+        std::pair<std::uint32_t *, bool> try_emplace(std::uint32_t key, std::uint32_t value)
+        {
+            if (std::uint32_t *found = find(key))
+                return {found, false};
+
+            // Keep the table at most 7/8 full, so that every probe sequence reaches an empty slot.
+            if ((this->count + 1) * 8 > capacity() * 7)
+                rehash(capacity() == 0 ? group_size : capacity() * 2);
+
+            slot *placed = place(key, value);
+            this->count++;
+            return {&placed->value, true};
+        }
+
+        // Finds the value of a key.
+        //
+        //   * std::uint32_t key - The key.
+        //
+        //   * return (std::uint32_t *) - The value, or nullptr if the key is not present.
+        std::uint32_t *find(std::uint32_t key)
+        {
+            return const_cast<std::uint32_t *>(static_cast<const flat_table *>(this)->find(key));
+        }
+
+        // Finds the value of a key.
+        //
+        //   * std::uint32_t key - The key.
+        //
+        //   * return (const std::uint32_t *) - The value, or nullptr if the key is not present.
+        const std::uint32_t *find(std::uint32_t key) const
+        {
+            if (this->count == 0)
+                return nullptr;
+
+            std::uint64_t h = hash(key);
+            std::uint8_t tag = h & 0x7f;
+            std::size_t group = (h >> 7) & this->mask & ~(group_size - 1);
+            for (std::size_t step = group_size;; step += group_size)
+            {
+                for (std::uint32_t matches = match(group, tag); matches != 0; matches &= matches - 1)
+                {
+                    const slot &candidate = this->slots[group + count_trailing_zeros(matches)];
+                    if (candidate.key == key)
+                        return &candidate.value;
+                }
+                if (match_empty(group) != 0)
+                    return nullptr;
+                group = (group + step) & this->mask;
+            }
+        }
+
+        // Returns the number of keys.
+        //
+        //   * return (std::size_t) - The number of keys.
+        std::size_t size() const
+        {
+            return this->count;
+        }
+
+        // Returns whether the table has no keys.
+        //
+        //   * return (bool) - Whether the table is empty.
+        bool empty() const
+        {
+            return this->count == 0;
+        }
+
+        // Returns the number of slots.
+        //
+        //   * return (std::size_t) - The number of slots. Zero until the first insert.
+        std::size_t capacity() const
+        {
+            return this->control == nullptr ? 0 : this->mask + 1;
+        }
+
+        // Removes every key, and frees the storage.
+        void clear()
+        {
+            release();
+        }
+
+        private:
+        // A key and its value.
+        struct slot
+        {
+            std::uint32_t key;
+            std::uint32_t value;
+        };
+
+        // The control byte of an empty slot. Full slots hold 7 bits of their key's hash.
+        static constexpr std::uint8_t empty_slot = 0x80;
+
+        // Mixes the bits of a key, so that nearby ids spread across the table.
+        //
+        //   * std::uint32_t key - The key.
+        //
+        //   * return (std::uint64_t) - The hash.
+        static std::uint64_t hash(std::uint32_t key)
+        {
+            std::uint64_t h = (std::uint64_t)key * 0x9e3779b97f4a7c15ull;
+            return h ^ (h >> 32);
+        }
+
+        // Returns the index of the lowest set bit.
+        //
+        //   * std::uint32_t bits - The bits. Must not be zero.
+        //
+        //   * return (int) - The index of the lowest set bit.
+        static int count_trailing_zeros(std::uint32_t bits)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(bits);
+#else
+            int index = 0;
+            while ((bits & 1) == 0)
+            {
+                bits >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        // Compares the control bytes of a group against a byte.
+        //
+        //   * std::size_t group - The index of the first slot in the group.
+        //   * std::uint8_t byte - The byte to look for.
+        //
+        //   * return (std::uint32_t) - A bit for each control byte in the group that matches.
+        std::uint32_t match(std::size_t group, std::uint8_t byte) const
+        {
+#ifdef ARGH_FLAT_TABLE_SSE2
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(this->control + group));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)byte)));
+#else
+            std::uint32_t matches = 0;
+            for (std::size_t i = 0; i < group_size; i++)
+                matches |= (std::uint32_t)(this->control[group + i] == byte) << i;
+            return matches;
+#endif
+        }
+
+        // Finds the empty slots of a group.
+        // Only empty slots have the high bit of their control byte set, so with SSE2 this is a single movemask.
+        //
+        //   * std::size_t group - The index of the first slot in the group.
+        //
+        //   * return (std::uint32_t) - A bit for each empty slot in the group.
+        std::uint32_t match_empty(std::size_t group) const
+        {
+#ifdef ARGH_FLAT_TABLE_SSE2
+            return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(this->control + group)));
+#else
+            return match(group, empty_slot);
+#endif
+        }
+
+        // Puts a key that is not yet present into its first empty slot.
+        //
+        //   * std::uint32_t key   - The key.
+        //   * std::uint32_t value - The value.
+        //
+        //   * return (slot *) - The slot.
+        slot *place(std::uint32_t key, std::uint32_t value)
+        {
+            std::uint64_t h = hash(key);
+            std::size_t group = (h >> 7) & this->mask & ~(group_size - 1);
+            for (std::size_t step = group_size;; step += group_size)
+            {
+                std::uint32_t open = match_empty(group);
+                if (open != 0)
+                {
+                    std::size_t index = group + count_trailing_zeros(open);
+                    this->control[index] = h & 0x7f;
+                    this->slots[index] = slot{key, value};
+                    return &this->slots[index];
+                }
+                group = (group + step) & this->mask;
+            }
+        }
+
+        // Moves every key into a table with more slots.
+        //
+        //   * std::size_t slot_count - The new number of slots. A power of two, and a multiple of group_size.
+        void rehash(std::size_t slot_count)
+        {
+            std::uint8_t *old_control = this->control;
+            slot *old_slots = this->slots;
+            std::size_t old_count = old_control == nullptr ? 0 : this->mask + 1;
+
+            allocate(slot_count);
+            for (std::size_t i = 0; i < old_count; i++)
+            {
+                if (old_control[i] != empty_slot)
+                    place(old_slots[i].key, old_slots[i].value);
+            }
+            delete[] reinterpret_cast<std::uint8_t *>(old_slots);
+        }
+
+        // Allocates empty storage for a number of slots.
+        // The control bytes and the slots share one allocation, with the slots first for their alignment.
+        //
+        //   * std::size_t slot_count - The number of slots.
+        void allocate(std::size_t slot_count)
+        {
+            std::uint8_t *storage = new std::uint8_t[slot_count * (sizeof(slot) + 1)];
+            this->slots = reinterpret_cast<slot *>(storage);
+            this->control = storage + slot_count * sizeof(slot);
+            std::memset(this->control, empty_slot, slot_count);
+            this->mask = slot_count - 1;
+        }
+
+        // Frees the storage, and leaves the table empty.
+        void release()
+        {
+            delete[] reinterpret_cast<std::uint8_t *>(this->slots);
+            this->control = nullptr;
+            this->slots = nullptr;
+            this->mask = 0;
+            this->count = 0;
+        }
+
+        // The control bytes, or nullptr before the first insert.
+        std::uint8_t *control;
+
+        // The slots.
+        slot *slots;
+
+        // The number of slots, minus one.
+        std::size_t mask;
+
+        // The number of keys.
+        std::size_t count;
+    };
+}
+
+#endif
@@ -0,0 +1,134 @@
+// src/argh/fuzz/argh.fuzz.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the libFuzzer harness for the argh library.
+//
+// The input is a command line with one token per line. Its first byte picks the constructor
+// (char *argv[], std::string argv[], an owned vector of strings or a borrowed span of views,
+// with or without a registry), and the tokens also drive a sequence of queries. Besides crashes, the harness fails on
+// inputs that take too long for their size, so that superlinear behavior is caught too.
+// The limit is 2,000 nanoseconds per byte on top of a 10 millisecond floor; set
+// ARGH_FUZZ_NS_PER_BYTE to change it (for instance, under sanitizers).
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "argh/argh.h"
+#include "argh/options.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The most queries made per input. Each query may be linear in the size of the input,
+// so an unbounded number of them would make the harness itself quadratic.
+static const long unsigned int max_queries = 64;
+
+// The time allowed per byte of input, in nanoseconds.
+static long int limit_per_byte()
+{
+    static const long int limit = []() {
+        const char *setting = std::getenv("ARGH_FUZZ_NS_PER_BYTE");
+        return setting != nullptr ? std::atol(setting) : 2000L;
+    }();
+    return limit;
+}
+
+// Parses the input and runs the queries.
+//
+//   * const uint8_t *data - The input.
+//   * size_t size         - The size of the input.
+static void run(const uint8_t *data, size_t size)
+{
+    if (size == 0)
+        return;
+    int variant = data[0] % 7;
+
+    std::vector<std::string> tokens;
+    std::string current;
+    for (size_t i = 1; i < size; i++)
+    {
+        if (data[i] == '\n')
+        {
+            tokens.push_back(current);
+            current.clear();
+        }
+        else
+        {
+            current.push_back((char)data[i]);
+        }
+    }
+    tokens.push_back(current);
+
+    std::vector<char *> pointers;
+    for (std::string &token : tokens)
+        pointers.push_back(token.data());
+
+    argh::options opts;
+    opts.add("--verbose");
+    opts.add("--version");
+    opts.add("--output");
+    opts.add("-o");
+
+    // The views borrow the tokens, which outlive the instance.
+    std::vector<std::string_view> views(tokens.begin(), tokens.end());
+    std::span<const std::string_view> span(views);
+
+    argh::argh args = variant == 0   ? argh::argh(pointers.size(), pointers.data())
+                      : variant == 1 ? argh::argh(tokens.size(), tokens.data())
+                      : variant == 2 ? argh::argh(pointers.size(), pointers.data(), opts)
+                      : variant == 3 ? argh::argh(std::vector<std::string>(tokens))
+                      : variant == 4 ? argh::argh(std::vector<std::string>(tokens), opts)
+                      : variant == 5 ? argh::argh(span)
+                                     : argh::argh(span, opts);
+
+    for (long unsigned int i = 0; i < tokens.size() && i < max_queries; i++)
+    {
+        const std::string &token = tokens[i];
+        switch ((token.length() + i) % 5)
+        {
+        case 0:
+            (void)args[token];
+            break;
+        case 1:
+            (void)args(token);
+            break;
+        case 2:
+            (void)args[(int)(i * 7919 % (tokens.size() + 2)) - 1];
+            break;
+        case 3:
+            args.mark_parameter(token);
+            break;
+        default:
+            (void)args.size();
+            (void)args.ambiguous_options();
+            break;
+        }
+    }
+    for (int i = 0; i < args.size() && i < (int)max_queries; i++)
+        (void)args[i];
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    auto start = std::chrono::steady_clock::now();
+    run(data, size);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    long int nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    long int allowed = 10000000L + (long int)size * limit_per_byte();
+    if (nanoseconds > allowed)
+    {
+        std::fprintf(stderr, "argh.fuzz: %zu-byte input took %ld ns (allowed %ld ns)\n", size, nanoseconds, allowed);
+        std::abort();
+    }
+    return 0;
+}
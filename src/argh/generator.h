@@ -0,0 +1,177 @@
+// src/argh/generator.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the generator class.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <coroutine>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace argh
+{
+    // A coroutine that yields values of type T one at a time, in the style of C++23's std::generator.
+    // The coroutine only runs when the consumer asks for the next value, so a consumer that stops
+    // early never pays for the values it didn't pull. The values are yielded by reference:
+    // each one is valid until the generator is resumed.
+    //
+    //    argh::generator<int> count(int n)
+    //    {
+    //        for (int i = 0; i < n; i++)
+    //            co_yield i;
+    //    }
+    //
+    //    for (int i : count(10))
+    //        std::cout << i << std::endl;
+    //
+    // A generator is an input range, and can't be copied.
+    template <typename T>
+    class generator : public std::ranges::view_interface<generator<T>>
+    {
+        public:
+        // The state that the coroutine shares with its generator.
+        struct promise_type
+        {
+            generator get_return_object()
+            {
+                return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            // The coroutine doesn't start until the first value is asked for.
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+
+            // Keeps a pointer to the yielded value. It lives in the suspended coroutine until it resumes.
+            std::suspend_always yield_value(const T &value) noexcept
+            {
+                this->current = std::addressof(value);
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            // Exceptions propagate to whoever resumed the coroutine.
+            void unhandled_exception() { throw; }
+
+            // A generator only yields; it can't await anything.
+            template <typename U>
+            std::suspend_never await_transform(U &&) = delete;
+
+            // The last value yielded.
+            const T *current = nullptr;
+        };
+
+        // The iterator of a generator.
+        class iterator
+        {
+            public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            // The zero-argument constructor that creates a singular iterator.
+            iterator() : coroutine(nullptr)
+            {
+            }
+
+            // The one-argument constructor.
+            //
+            //   * std::coroutine_handle<promise_type> coroutine - The coroutine to pull values from.
+            explicit iterator(std::coroutine_handle<promise_type> coroutine) : coroutine(coroutine)
+            {
+            }
+
+            const T &operator*() const { return *this->coroutine.promise().current; }
+
+            iterator &operator++()
+            {
+                this->coroutine.resume();
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(const iterator &it, std::default_sentinel_t)
+            {
+                return !it.coroutine || it.coroutine.done();
+            }
+
+            private:
+            // The coroutine to pull values from.
+            std::coroutine_handle<promise_type> coroutine;
+        };
+
+        // The zero-argument constructor that creates an empty generator.
+        generator() : coroutine(nullptr)
+        {
+        }
+
+        // The move constructor.
+        //
+        //   * generator &&other - The generator to move from. It is left empty.
+        generator(generator &&other) noexcept : coroutine(std::exchange(other.coroutine, nullptr))
+        {
+        }
+
+        // The move assignment operator.
+        //
+        //   * generator &&other - The generator to move from. It is left empty.
+        generator &operator=(generator &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (this->coroutine)
+                    this->coroutine.destroy();
+                this->coroutine = std::exchange(other.coroutine, nullptr);
+            }
+            return *this;
+        }
+
+        generator(const generator &) = delete;
+        generator &operator=(const generator &) = delete;
+
+        // The destructor. It destroys the coroutine, wherever it is suspended.
+        ~generator()
+        {
+            if (this->coroutine)
+                this->coroutine.destroy();
+        }
+
+        // Runs the coroutine up to its first value.
+        // Only call it once: a generator can only be iterated over once.
+        //
+        //   * return (iterator) - The iterator to the first value.
+        iterator begin()
+        {
+            if (this->coroutine)
+                this->coroutine.resume();
+            return iterator(this->coroutine);
+        }
+
+        std::default_sentinel_t end() const { return std::default_sentinel; }
+
+        private:
+        // The one-argument constructor, used by the promise.
+        //
+        //   * std::coroutine_handle<promise_type> coroutine - The coroutine.
+        explicit generator(std::coroutine_handle<promise_type> coroutine) : coroutine(coroutine)
+        {
+        }
+
+        // The coroutine, or nullptr.
+        std::coroutine_handle<promise_type> coroutine;
+    };
+}
+
+#endif
@@ -0,0 +1,291 @@
+// src/argh/intern.cc
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the option name interning table.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "intern.h"
+#include "config.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argh
+{
+    // The table is shared by every translation unit, so its helpers are not in an anonymous namespace.
+    namespace intern_detail
+    {
+        // An interned name. The characters follow the entry in the same allocation.
+        struct entry
+        {
+            std::size_t hash;
+            std::string_view view;
+            std::uint32_t id;
+
+            // Returns the name.
+            //
+            //   * return (const std::string_view &) - The name.
+            const std::string_view &name() const
+            {
+                return this->view;
+            }
+        };
+
+        // The name of no_name, and of the ids that are unknown.
+        inline const std::string_view none;
+
+        // A hash table of entries, with linear probing, and the entries indexed by id.
+        // It is never more than half full. Once it would be, the writer builds a table twice
+        // the size and publishes that instead; the old one stays alive for readers still using it.
+        struct table
+        {
+            // The one-argument constructor that creates an empty table.
+            //
+            //   * std::uint32_t slot_count - The number of slots. Must be a power of two.
+            table(std::uint32_t slot_count)
+                : mask(slot_count - 1),
+                  slots(new std::atomic<const entry *>[slot_count]()),
+                  by_id(new std::atomic<const entry *>[slot_count / 2 + 1]())
+            {
+            }
+
+            // The largest id that the table has room for.
+            std::uint32_t max_id() const
+            {
+                return (this->mask + 1) / 2;
+            }
+
+            std::uint32_t mask;
+            std::unique_ptr<std::atomic<const entry *>[]> slots;
+            std::unique_ptr<std::atomic<const entry *>[]> by_id;
+        };
+
+        // The state shared by the whole process.
+        struct state
+        {
+            state() : current(nullptr)
+            {
+                this->tables.push_back(std::make_unique<table>(64));
+                this->current.store(this->tables.back().get(), std::memory_order_release);
+            }
+
+            // The table that readers should use.
+            std::atomic<table *> current;
+
+            // Serializes the writers, and guards everything below.
+            std::mutex lock;
+
+            // The number of names interned so far.
+            std::uint32_t count = 0;
+
+            // Every table ever published, including the current one.
+            std::vector<std::unique_ptr<table>> tables;
+
+            // The storage of every entry.
+            std::vector<std::unique_ptr<char[]>> entries;
+        };
+
+        // Returns the shared state. It is never destroyed, so that threads that
+        // are still running while the process exits can keep using it.
+        //
+        //   * return (state &) - The shared state.
+        ARGH_INLINE state &shared()
+        {
+            static state *instance = new state();
+            return *instance;
+        }
+
+        // Finds the entry of a name in a table.
+        //
+        //   * const table &t        - The table.
+        //   * std::string_view name - The name.
+        //   * std::size_t hash      - The hash of the name.
+        //
+        //   * return (const entry *) - The entry, or nullptr if the name is not in the table.
+        ARGH_INLINE const entry *lookup(const table &t, std::string_view name, std::size_t hash)
+        {
+            for (std::size_t i = hash & t.mask;; i = (i + 1) & t.mask)
+            {
+                const entry *e = t.slots[i].load(std::memory_order_acquire);
+                if (e == nullptr)
+                    return nullptr;
+                if (e->hash == hash && e->name() == name)
+                    return e;
+            }
+        }
+
+        // Adds an entry to a table. Only called by a writer holding the lock.
+        //
+        //   * table &t        - The table.
+        //   * const entry *e  - The entry.
+        ARGH_INLINE void place(table &t, const entry *e)
+        {
+            t.by_id[e->id].store(e, std::memory_order_release);
+
+            std::size_t i = e->hash & t.mask;
+            while (t.slots[i].load(std::memory_order_relaxed) != nullptr)
+                i = (i + 1) & t.mask;
+            t.slots[i].store(e, std::memory_order_release);
+        }
+
+        // Replaces the current table with one twice the size. Only called by a writer holding the lock.
+        //
+        //   * state &s - The shared state.
+        //
+        //   * return (table &) - The new table.
+        ARGH_INLINE table &grow(state &s)
+        {
+            const table &old = *s.current.load(std::memory_order_relaxed);
+            s.tables.push_back(std::make_unique<table>((old.mask + 1) * 2));
+            table &bigger = *s.tables.back();
+
+            for (std::uint32_t id = 1; id <= s.count; id++)
+                place(bigger, old.by_id[id].load(std::memory_order_relaxed));
+
+            s.current.store(&bigger, std::memory_order_release);
+            return bigger;
+        }
+    }
+
+    // Returns the id of a name, interning it first if it has never been seen.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if the table has no room for it.
+    ARGH_INLINE std::uint32_t intern(std::string_view name)
+    {
+        using namespace intern_detail;
+
+        if (name.length() > intern_max_length)
+            return no_name;
+
+        state &s = shared();
+        std::size_t hash = std::hash<std::string_view>()(name);
+
+        if (const entry *e = lookup(*s.current.load(std::memory_order_acquire), name, hash))
+            return e->id;
+
+        std::lock_guard<std::mutex> guard(s.lock);
+
+        // Another writer might have inserted the name since we looked.
+        table *t = s.current.load(std::memory_order_relaxed);
+        if (const entry *e = lookup(*t, name, hash))
+            return e->id;
+
+        if (s.count >= intern_capacity)
+            return no_name;
+        if (s.count + 1 > t->max_id())
+            t = &grow(s);
+
+        std::unique_ptr<char[]> storage(new char[sizeof(entry) + name.length()]);
+        std::memcpy(storage.get() + sizeof(entry), name.data(), name.length());
+        const entry *e = new (storage.get())
+            entry{hash, std::string_view(storage.get() + sizeof(entry), name.length()), s.count + 1};
+        s.entries.push_back(std::move(storage));
+        s.count++;
+
+        place(*t, e);
+        return e->id;
+    }
+
+    // Returns the id of a name, without interning it.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if it was never interned.
+    ARGH_INLINE std::uint32_t find_interned(std::string_view name)
+    {
+        using namespace intern_detail;
+
+        std::size_t hash = std::hash<std::string_view>()(name);
+        const entry *e = lookup(*shared().current.load(std::memory_order_acquire), name, hash);
+        return e == nullptr ? no_name : e->id;
+    }
+
+    // Returns the name that an id was given to.
+    //
+    //   * std::uint32_t id - The id, as returned by intern.
+    //
+    //   * return (const std::string_view &) - The name, or an empty view for no_name.
+    ARGH_INLINE const std::string_view &interned_name(std::uint32_t id)
+    {
+        using namespace intern_detail;
+
+        const table &t = *shared().current.load(std::memory_order_acquire);
+        if (id == no_name || id > t.max_id())
+            return none;
+
+        const entry *e = t.by_id[id].load(std::memory_order_acquire);
+        return e == nullptr ? none : e->name();
+    }
+
+    // Returns the id of a name, adding it first if it has never been seen.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name.
+    ARGH_INLINE std::uint32_t local_names::add(std::string_view name)
+    {
+        std::uint32_t id = find(name);
+        if (id != no_name)
+            return id;
+
+        id = local_name_bit | (std::uint32_t)this->names.size();
+        stored &added = this->names.emplace_back(stored{std::string(name), std::string_view()});
+        added.view = added.text;
+        this->ids.emplace(added.view, id);
+        return id;
+    }
+
+    // Returns the id of a name, without adding it.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if it was never added.
+    ARGH_INLINE std::uint32_t local_names::find(std::string_view name) const
+    {
+        auto found = this->ids.find(name);
+        return found == this->ids.end() ? no_name : found->second;
+    }
+
+    // Returns the name that an id was given to.
+    //
+    //   * std::uint32_t id - The id, as returned by add.
+    //
+    //   * return (const std::string_view &) - The name, or an empty view if the id is not from this table.
+    ARGH_INLINE const std::string_view &local_names::name(std::uint32_t id) const
+    {
+        std::uint32_t index = id & ~local_name_bit;
+        if ((id & local_name_bit) == 0 || index >= this->names.size())
+            return intern_detail::none;
+        return this->names[index].view;
+    }
+
+    // Returns the name that an id was given to, whether by the shared table or by a local one.
+    //
+    //   * std::uint32_t id          - The id, as returned by intern or local_names::add.
+    //   * const local_names *locals - The local table, or nullptr if there is none.
+    //
+    //   * return (const std::string_view &) - The name, or an empty view if it is unknown.
+    ARGH_INLINE const std::string_view &interned_name(std::uint32_t id, const local_names *locals)
+    {
+        if ((id & local_name_bit) == 0)
+            return interned_name(id);
+        return locals == nullptr ? intern_detail::none : locals->name(id);
+    }
+}
@@ -0,0 +1,119 @@
+// src/argh/intern.h
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the option name interning headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace argh
+{
+    // The id that no name is ever given.
+    constexpr std::uint32_t no_name = 0;
+
+    // The most names the shared table holds, and the longest name it holds.
+    // The table is never freed, so these bound what hostile argv vectors can make it keep.
+    constexpr std::uint32_t intern_capacity = 1 << 16;
+    constexpr std::size_t intern_max_length = 128;
+
+    // The bit that marks the ids given out by a local_names table.
+    constexpr std::uint32_t local_name_bit = 0x80000000;
+
+    // Returns the id of a name, interning it first if it has never been seen.
+    // The table is shared by the whole process: a name keeps its id for as long as
+    // the process runs, and its storage is never freed. Names that are already
+    // interned are found without taking a lock; new names are inserted under one.
+    // Once the table holds intern_capacity names, new names are refused, as are names
+    // longer than intern_max_length; the caller keeps those in a local_names table instead.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if the table has no room for it.
+    std::uint32_t intern(std::string_view name);
+
+    // Returns the id of a name, without interning it.
+    // This never takes a lock, so use it for names that might never have been seen.
+    //
+    //   * std::string_view name - The name.
+    //
+    //   * return (std::uint32_t) - The id of the name, or no_name if it was never interned.
+    std::uint32_t find_interned(std::string_view name);
+
+    // Returns the name that an id was given to.
+    //
+    //   * std::uint32_t id - The id, as returned by intern.
+    //
+    //   * return (const std::string_view &) - The name. Both the view and its characters last as long as the process.
+    const std::string_view &interned_name(std::uint32_t id);
+
+    // The argh::local_names class holds the names that the shared table refused, for one owner.
+    // Its ids have local_name_bit set, so they never collide with those of the shared table.
+    // It is freed with its owner.
+    class local_names
+    {
+        public:
+        // Returns the id of a name, adding it first if it has never been seen.
+        //
+        //   * std::string_view name - The name.
+        //
+        //   * return (std::uint32_t) - The id of the name.
+        std::uint32_t add(std::string_view name);
+
+        // Returns the id of a name, without adding it.
+        //
+        //   * std::string_view name - The name.
+        //
+        //   * return (std::uint32_t) - The id of the name, or no_name if it was never added.
+        std::uint32_t find(std::string_view name) const;
+
+        // Returns the name that an id was given to.
+        //
+        //   * std::uint32_t id - The id, as returned by add.
+        //
+        //   * return (const std::string_view &) - The name, or an empty view if the id is not from this table.
+        //                                         The view itself lives as long as the table.
+        const std::string_view &name(std::uint32_t id) const;
+
+        private:
+        // A name, with a view of it for name to return.
+        struct stored
+        {
+            std::string text;
+            std::string_view view;
+        };
+
+        // The names, by id without local_name_bit. A deque never moves its elements as it grows.
+        std::deque<stored> names;
+
+        // The id of each name, keyed by views into names.
+        std::unordered_map<std::string_view, std::uint32_t> ids;
+    };
+
+    // Returns the name that an id was given to, whether by the shared table or by a local one.
+    //
+    //   * std::uint32_t id          - The id, as returned by intern or local_names::add.
+    //   * const local_names *locals - The local table, or nullptr if there is none.
+    //
+    //   * return (const std::string_view &) - The name, or an empty view if it is unknown.
+    const std::string_view &interned_name(std::uint32_t id, const local_names *locals);
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "intern.cc"
+#endif
+
+#endif
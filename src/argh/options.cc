@@ -0,0 +1,160 @@
+// src/argh/options.cc
+// v0.6.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the options class.
+// Use this utility to register the options that a program understands.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "options.h"
+#include "config.h"
+#include "trie.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // The zero-argument constructor that creates an empty registry.
+    ARGH_INLINE options::options()
+    {
+    }
+
+    // Registers an option.
+    //
+    //   * std::string name - The name of the option, including its dashes.
+    //
+    //   * return (int) - The id of the option.
+    ARGH_INLINE int options::add(std::string name)
+    {
+        return add(name, nullptr, nullptr);
+    }
+
+    // Registers an option along with its help text.
+    // The help text is not copied, so string literals cost nothing at startup;
+    // it is only read when a usage message is rendered.
+    //
+    //   * std::string name        - The name of the option, including its dashes.
+    //   * const char *description - A one-line description of the option.
+    //   * const char *value_name  - The name of the option's value, or nullptr for a flag.
+    //
+    //   * return (int) - The id of the option.
+    ARGH_INLINE int options::add(std::string name, const char *description, const char *value_name)
+    {
+        int id = this->lookup.find(name);
+        if (id != trie::not_found)
+        {
+            if (description != nullptr)
+                this->descriptions[id] = description;
+            if (value_name != nullptr)
+                this->value_names[id] = value_name;
+            return id;
+        }
+
+        id = this->names.size();
+        this->lookup.insert(name, id);
+        this->names.push_back(name);
+        this->descriptions.push_back(description);
+        this->value_names.push_back(value_name);
+        return id;
+    }
+
+    // Looks up an option by name.
+    // Long options may be abbreviated to any unique prefix, as in getopt_long;
+    // short options must match exactly.
+    //
+    //   * std::string_view name - The name of the option, including its dashes.
+    //
+    //   * return (int) - The id of the option, options::not_found, or options::ambiguous.
+    ARGH_INLINE int options::find(std::string_view name) const
+    {
+        // Only a double dash followed by at least one character starts an abbreviation.
+        if (name.length() > 2 && name[0] == '-' && name[1] == '-')
+            return this->lookup.find_prefix(name);
+        return this->lookup.find(name);
+    }
+
+    // Collects the options whose names start with the given prefix, in name order.
+    //
+    //   * std::string_view prefix - The prefix to look up.
+    //   * std::vector<int> &ids   - The vector to append the ids of the options to.
+    ARGH_INLINE void options::complete(std::string_view prefix, std::vector<int> &ids) const
+    {
+        this->lookup.collect(prefix, ids);
+    }
+
+    // Returns the name of an option.
+    //
+    //   * int id - The id of the option.
+    //
+    //   * return (const std::string &) - The name of the option.
+    ARGH_INLINE const std::string &options::name(int id) const
+    {
+        return this->names[id];
+    }
+
+    // Returns the description of an option.
+    //
+    //   * int id - The id of the option.
+    //
+    //   * return (const char *) - The description of the option, or nullptr if it has none.
+    ARGH_INLINE const char *options::description(int id) const
+    {
+        return this->descriptions[id];
+    }
+
+    // Returns the name of an option's value.
+    //
+    //   * int id - The id of the option.
+    //
+    //   * return (const char *) - The name of the option's value, or nullptr for a flag.
+    ARGH_INLINE const char *options::value_name(int id) const
+    {
+        return this->value_names[id];
+    }
+
+    // Returns the number of registered options.
+    //
+    //   * return (int) - The number of registered options.
+    ARGH_INLINE int options::size() const
+    {
+        return this->names.size();
+    }
+
+    // Turns validation of the arguments on or off.
+    //
+    //   * bool enable - Whether to validate the arguments.
+    ARGH_INLINE void options::validate_text(bool enable)
+    {
+        this->validate = enable;
+    }
+
+    // Returns whether the arguments are validated.
+    //
+    //   * return (bool) - Whether to validate the arguments.
+    ARGH_INLINE bool options::validates_text() const
+    {
+        return this->validate;
+    }
+
+    // Turns reading of response files on or off.
+    //
+    //   * bool enable - Whether to read response files.
+    ARGH_INLINE void options::read_response_files(bool enable)
+    {
+        this->response_files = enable;
+    }
+
+    // Returns whether response files are read.
+    //
+    //   * return (bool) - Whether to read response files.
+    ARGH_INLINE bool options::reads_response_files() const
+    {
+        return this->response_files;
+    }
+}
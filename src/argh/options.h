@@ -0,0 +1,157 @@
+// src/argh/options.h
+// v0.6.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the options headers.
+// Use this utility to register the options that a program understands.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "trie.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // The argh::options class is a registry of the options that a program understands.
+    //
+    // argh does not need to know the options ahead of time, so the registry is entirely opt-in.
+    // Passing a registry to the argh constructor enables the features that depend on it,
+    // such as resolving unique abbreviations of long options:
+    //
+    //    argh::options opts;
+    //    opts.add("--verbose");
+    //    opts.add("--version");
+    //
+    //    argh::argh args(argc, argv, opts);
+    //    // "--verb" is now stored as "--verbose", and "--ver" is reported as ambiguous.
+    //
+    class options
+    {
+        public:
+        // The value returned by find when no option matches.
+        static constexpr int not_found = trie::not_found;
+
+        // The value returned by find when more than one option matches.
+        static constexpr int ambiguous = trie::ambiguous;
+
+        // The zero-argument constructor that creates an empty registry.
+        options();
+
+        // Registers an option.
+        //
+        //   * std::string name - The name of the option, including its dashes.
+        //
+        //   * return (int) - The id of the option.
+        int add(std::string name);
+
+        // Registers an option along with its help text.
+        // The help text is not copied, so string literals cost nothing at startup;
+        // it is only read when a usage message is rendered (see usage.h).
+        //
+        //   * std::string name        - The name of the option, including its dashes.
+        //   * const char *description - A one-line description of the option.
+        //   * const char *value_name  - The name of the option's value, or nullptr for a flag.
+        //
+        //   * return (int) - The id of the option.
+        int add(std::string name, const char *description, const char *value_name = nullptr);
+
+        // Looks up an option by name.
+        // Long options may be abbreviated to any unique prefix, as in getopt_long;
+        // short options must match exactly.
+        //
+        //   * std::string_view name - The name of the option, including its dashes.
+        //
+        //   * return (int) - The id of the option, options::not_found, or options::ambiguous.
+        int find(std::string_view name) const;
+
+        // Collects the options whose names start with the given prefix, in name order.
+        //
+        //   * std::string_view prefix - The prefix to look up.
+        //   * std::vector<int> &ids   - The vector to append the ids of the options to.
+        void complete(std::string_view prefix, std::vector<int> &ids) const;
+
+        // Returns the name of an option.
+        //
+        //   * int id - The id of the option.
+        //
+        //   * return (const std::string &) - The name of the option.
+        const std::string &name(int id) const;
+
+        // Returns the description of an option.
+        //
+        //   * int id - The id of the option.
+        //
+        //   * return (const char *) - The description of the option, or nullptr if it has none.
+        const char *description(int id) const;
+
+        // Returns the name of an option's value.
+        //
+        //   * int id - The id of the option.
+        //
+        //   * return (const char *) - The name of the option's value, or nullptr for a flag.
+        const char *value_name(int id) const;
+
+        // Returns the number of registered options.
+        //
+        //   * return (int) - The number of registered options.
+        int size() const;
+
+        // Turns validation of the arguments on or off. It is off by default.
+        // When it is on, arguments that are not valid UTF-8, or that hold control characters,
+        // are rejected as they are scanned instead of being parsed (see utf8.h).
+        //
+        //   * bool enable - Whether to validate the arguments.
+        void validate_text(bool enable = true);
+
+        // Returns whether the arguments are validated.
+        //
+        //   * return (bool) - Whether to validate the arguments.
+        bool validates_text() const;
+
+        // Turns reading of response files on or off. It is off by default.
+        // When it is on, parse_async replaces each "@file" argument by the arguments in that file
+        // (see async.h). The argh constructors never read files, so they keep "@file" as it is.
+        //
+        //   * bool enable - Whether to read response files.
+        void read_response_files(bool enable = true);
+
+        // Returns whether response files are read.
+        //
+        //   * return (bool) - Whether to read response files.
+        bool reads_response_files() const;
+
+        private:
+        // The names of the registered options, indexed by id.
+        std::vector<std::string> names;
+
+        // The descriptions of the registered options, indexed by id.
+        std::vector<const char *> descriptions;
+
+        // The names of the values of the registered options, indexed by id.
+        std::vector<const char *> value_names;
+
+        // All of the registered names, keyed by name.
+        trie lookup;
+
+        // Whether the arguments are validated.
+        bool validate = false;
+
+        // Whether response files are read.
+        bool response_files = false;
+    };
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "options.cc"
+#endif
+
+#endif
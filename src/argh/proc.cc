@@ -0,0 +1,480 @@
+// src/argh/proc.cc
+// v0.1.1
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the process table scanner.
+// Use this utility to classify the command lines of every process on the system.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "proc.h"
+
+#include "scanner.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace argh
+{
+    namespace
+    {
+        // The number of processes that a thread claims at a time.
+        constexpr std::size_t batch = 32;
+    }
+
+    // Records the options of the schema that one process was given.
+    struct process_scanner::recorder : visitor
+    {
+        // Stores an option, replacing its earlier value if the process was given it already.
+        //
+        //   * int option            - The id of the option in the schema.
+        //   * std::string_view text - The value, or an empty view.
+        void record(int option, std::string_view value)
+        {
+            std::uint32_t value_begin = this->text->size();
+            this->text->append(value);
+            process_table::entry stored{option, value_begin, (std::uint32_t)value.length()};
+
+            for (std::size_t i = this->row_begin; i < this->entries->size(); i++)
+            {
+                if ((*this->entries)[i].option == option)
+                {
+                    (*this->entries)[i] = stored;
+                    return;
+                }
+            }
+            this->entries->push_back(stored);
+        }
+
+        void on_argument(std::string_view arg, token_kind kind)
+        {
+            this->matched = false;
+            if (kind != token_kind::positional && kind != token_kind::dash)
+                this->pending = -1;
+            if (kind != token_kind::short_cluster && kind != token_kind::short_with_value)
+                return;
+
+            // Look for the longest single-dash option that the argument starts with.
+            int best = -1;
+            std::size_t best_length = 0;
+            for (int id : *this->attached)
+            {
+                const std::string &name = this->schema->name(id);
+                if (name.length() > best_length && arg.starts_with(name))
+                {
+                    best = id;
+                    best_length = name.length();
+                }
+            }
+            if (best != -1)
+            {
+                // Given on its own, an option with a value name takes the next argument as its value.
+                record(best, arg.substr(best_length));
+                if (best_length == arg.length() && this->schema->value_name(best) != nullptr)
+                    this->pending = best;
+                this->matched = true;
+            }
+        }
+
+        void on_flag(std::string_view name)
+        {
+            if (this->matched)
+                return;
+            int id = this->schema->find(name);
+            if (id < 0)
+            {
+                this->pending = -1;
+                return;
+            }
+            record(id, std::string_view());
+            this->pending = this->schema->value_name(id) != nullptr ? id : -1;
+        }
+
+        void on_parameter(std::string_view name, std::string_view value)
+        {
+            if (this->matched)
+                return;
+            int id = this->schema->find(name);
+            if (id >= 0)
+                record(id, value);
+        }
+
+        void on_positional(std::string_view value, std::string_view owner)
+        {
+            if (this->pending != -1 && !owner.empty())
+                record(this->pending, value);
+            this->pending = -1;
+        }
+
+        // The options to look for.
+        const options *schema;
+
+        // The single-dash options with longer names.
+        const std::vector<int> *attached;
+
+        // The entries to store the options in.
+        std::vector<process_table::entry> *entries;
+
+        // The string to store the values in.
+        std::string *text;
+
+        // The first of this process's entries.
+        std::size_t row_begin;
+
+        // The option that takes the next argument as its value, or -1.
+        int pending = -1;
+
+        // Whether the current argument matched a single-dash option with a longer name.
+        bool matched = false;
+    };
+
+    // Returns the number of processes in the table.
+    //
+    //   * return (int) - The number of processes.
+    int process_table::size() const
+    {
+        return this->rows.size();
+    }
+
+    // Returns the PID of a process.
+    //
+    //   * int row - The row of the process.
+    //
+    //   * return (int) - The PID.
+    int process_table::pid(int row) const
+    {
+        return this->rows[row].pid;
+    }
+
+    // Finds a process by PID.
+    //
+    //   * int pid - The PID.
+    //
+    //   * return (int) - The row of the process, or -1 if it is not in the table.
+    int process_table::find(int pid) const
+    {
+        auto it = std::lower_bound(this->rows.begin(), this->rows.end(), pid,
+                                   [](const row &r, int p) { return r.pid < p; });
+        if (it == this->rows.end() || it->pid != pid)
+            return -1;
+        return it - this->rows.begin();
+    }
+
+    // Returns the command that a process runs: the first argument of its command line.
+    //
+    //   * int row - The row of the process.
+    //
+    //   * return (std::string_view) - The command, or an empty view for kernel threads.
+    std::string_view process_table::command(int row) const
+    {
+        return std::string_view(this->text).substr(this->rows[row].command_begin, this->rows[row].command_length);
+    }
+
+    // Returns whether a process was given an option.
+    //
+    //   * int row    - The row of the process.
+    //   * int option - The id of the option in the schema.
+    //
+    //   * return (bool) - True if the process was given the option.
+    bool process_table::has(int row, int option) const
+    {
+        return find_entry(row, option) != nullptr;
+    }
+
+    // Returns the value of an option that a process was given.
+    //
+    //   * int row    - The row of the process.
+    //   * int option - The id of the option in the schema.
+    //
+    //   * return (std::string_view) - The value, or an empty view if the option has none.
+    std::string_view process_table::value(int row, int option) const
+    {
+        const entry *found = find_entry(row, option);
+        if (found == nullptr)
+            return std::string_view();
+        return std::string_view(this->text).substr(found->value_begin, found->value_length);
+    }
+
+    // Removes every process, keeping the storage.
+    void process_table::clear()
+    {
+        this->rows.clear();
+        this->entries.clear();
+        this->text.clear();
+    }
+
+    // A helper method to find the entry of an option.
+    // A process is given few options, so a linear search is the fastest.
+    //
+    //   * int row    - The row of the process.
+    //   * int option - The id of the option in the schema.
+    //
+    //   * return (const entry *) - The entry, or nullptr.
+    const process_table::entry *process_table::find_entry(int row, int option) const
+    {
+        std::uint32_t begin = row == 0 ? 0 : this->rows[row - 1].entries_end;
+        for (std::uint32_t i = begin; i < this->rows[row].entries_end; i++)
+        {
+            if (this->entries[i].option == option)
+                return &this->entries[i];
+        }
+        return nullptr;
+    }
+
+    // The constructor, which starts the threads.
+    //
+    //   * const options &schema - The options to look for. It must outlive the scanner.
+    //   * int threads           - The number of threads to scan with, including the caller's.
+    //                             Zero means one per processor.
+    //   * std::string root      - The directory to read the processes from.
+    process_scanner::process_scanner(const options &schema, int threads, std::string root)
+        : schema(schema), root(std::move(root)), next(0)
+    {
+        for (int id = 0; id < schema.size(); id++)
+        {
+            const std::string &name = schema.name(id);
+            if (name.length() > 2 && name[0] == '-' && name[1] != '-')
+                this->attached.push_back(id);
+        }
+
+        if (threads <= 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        this->states.resize(threads);
+        for (int worker = 1; worker < threads; worker++)
+            this->pool.emplace_back(&process_scanner::run, this, worker);
+    }
+
+    // The destructor, which stops the threads.
+    process_scanner::~process_scanner()
+    {
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->stopping = true;
+        }
+        this->start.notify_all();
+        for (std::thread &thread : this->pool)
+            thread.join();
+    }
+
+    // Scans every process, replacing the contents of the table.
+    // The caller lists the processes, then every thread, the caller's included, claims
+    // batches of them until none are left. Each thread stores its results in its own buffers,
+    // and the caller merges them into the table in PID order.
+    //
+    //   * process_table &table - The table to store the processes in.
+    //
+    //   * return (bool) - True if the root directory could be read, false otherwise.
+    bool process_scanner::scan(process_table &table)
+    {
+        table.clear();
+
+        DIR *dir = opendir(this->root.c_str());
+        if (dir == nullptr)
+            return false;
+        this->pids.clear();
+        while (dirent *found = readdir(dir))
+        {
+            // Only the directories named by a number are processes.
+            int pid = 0;
+            const char *c = found->d_name;
+            for (; *c >= '0' && *c <= '9'; c++)
+                pid = pid * 10 + (*c - '0');
+            if (*c == '\0' && pid > 0)
+                this->pids.push_back(pid);
+        }
+        this->root_fd = dup(dirfd(dir));
+        closedir(dir);
+        if (this->root_fd == -1)
+            return false;
+        std::sort(this->pids.begin(), this->pids.end());
+
+        this->slots.resize(this->pids.size());
+        for (worker_state &state : this->states)
+        {
+            state.entries.clear();
+            state.text.clear();
+        }
+        this->next.store(0, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->generation++;
+            this->busy = this->pool.size();
+        }
+        this->start.notify_all();
+        work(0);
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->done.wait(guard, [this]() { return this->busy == 0; });
+        }
+        close(this->root_fd);
+        this->root_fd = -1;
+
+        // Merge the results of every thread.
+        std::size_t entry_count = 0;
+        for (worker_state &state : this->states)
+        {
+            state.base = table.text.size();
+            table.text += state.text;
+            entry_count += state.entries.size();
+        }
+        table.entries.reserve(entry_count);
+        table.rows.reserve(this->pids.size());
+        for (std::size_t i = 0; i < this->pids.size(); i++)
+        {
+            const slot &s = this->slots[i];
+            if (s.worker == -1)
+                continue;
+            const worker_state &state = this->states[s.worker];
+            for (std::uint32_t k = s.entries_begin; k < s.entries_end; k++)
+            {
+                process_table::entry e = state.entries[k];
+                e.value_begin += state.base;
+                table.entries.push_back(e);
+            }
+            table.rows.push_back(process_table::row{this->pids[i], (std::uint32_t)table.entries.size(),
+                                                    s.command_begin + state.base, s.command_length});
+        }
+        return true;
+    }
+
+    // Returns the number of threads that scan, including the caller's.
+    //
+    //   * return (int) - The number of threads.
+    int process_scanner::threads() const
+    {
+        return this->states.size();
+    }
+
+    // A helper method that the pool threads run.
+    // Each thread waits for a scan to start, takes part in it, and waits again.
+    //
+    //   * int worker - The index of the thread.
+    void process_scanner::run(int worker)
+    {
+        long int seen = 0;
+        std::unique_lock<std::mutex> guard(this->lock);
+        while (true)
+        {
+            this->start.wait(guard, [this, seen]() { return this->stopping || this->generation != seen; });
+            if (this->stopping)
+                return;
+            seen = this->generation;
+
+            guard.unlock();
+            work(worker);
+            guard.lock();
+
+            if (--this->busy == 0)
+                this->done.notify_one();
+        }
+    }
+
+    // A helper method to read and classify processes until none are left.
+    //
+    //   * int worker - The index of the thread.
+    void process_scanner::work(int worker)
+    {
+        std::size_t count = this->pids.size();
+        std::size_t begin;
+        while ((begin = this->next.fetch_add(batch, std::memory_order_relaxed)) < count)
+        {
+            std::size_t end = std::min(begin + batch, count);
+            for (std::size_t i = begin; i < end; i++)
+                read_process(worker, i);
+        }
+    }
+
+    // A helper method to read and classify one process.
+    // The command line is read whole into the thread's buffer, which only ever grows.
+    //
+    //   * int worker    - The index of the thread.
+    //   * std::size_t i - The index of the process in pids.
+    void process_scanner::read_process(int worker, std::size_t i)
+    {
+        worker_state &state = this->states[worker];
+        slot &s = this->slots[i];
+        s.worker = -1;
+
+        char path[32];
+        std::snprintf(path, sizeof(path), "%d/cmdline", this->pids[i]);
+        int fd = openat(this->root_fd, path, O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            return;
+
+        std::size_t length = 0;
+        while (true)
+        {
+            if (state.buffer.size() - length < 4096)
+                state.buffer.resize(std::max<std::size_t>(state.buffer.size() * 2, 4096));
+            ssize_t got = read(fd, state.buffer.data() + length, state.buffer.size() - length);
+            if (got == -1 && errno == EINTR)
+                continue;
+            if (got == -1)
+            {
+                close(fd);
+                return;
+            }
+            if (got == 0)
+                break;
+            length += got;
+        }
+        close(fd);
+
+        // The arguments are separated, and usually ended, by null characters.
+        state.arguments.clear();
+        const char *begin = state.buffer.data();
+        const char *end = begin + length;
+        while (begin < end)
+        {
+            const char *null = (const char *)std::memchr(begin, '\0', end - begin);
+            if (null == nullptr)
+                null = end;
+            state.arguments.emplace_back(begin, null - begin);
+            begin = null + 1;
+        }
+
+        s.worker = worker;
+        s.command_begin = state.text.size();
+        s.command_length = 0;
+        if (!state.arguments.empty())
+        {
+            state.text.append(state.arguments[0]);
+            s.command_length = state.arguments[0].length();
+        }
+        s.entries_begin = state.entries.size();
+        classify(state);
+        s.entries_end = state.entries.size();
+    }
+
+    // A helper method to classify a command line, skipping the command itself.
+    //
+    //   * worker_state &state - The buffers of the thread, holding the arguments.
+    void process_scanner::classify(worker_state &state)
+    {
+        scanner scan(&this->schema);
+        recorder r;
+        r.schema = &this->schema;
+        r.attached = &this->attached;
+        r.entries = &state.entries;
+        r.text = &state.text;
+        r.row_begin = state.entries.size();
+        for (std::size_t k = 1; k < state.arguments.size(); k++)
+            scan.scan(state.arguments[k], r);
+    }
+}
@@ -0,0 +1,294 @@
+// src/argh/proc.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the process table scanner headers.
+// Use this utility to classify the command lines of every process on the system.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef PROC_H
+#define PROC_H
+
+#include "options.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace argh
+{
+    // The argh::process_table class holds the options that each process was started with,
+    // as found by a process_scanner. Only the options in the scanner's schema are kept.
+    //
+    // The table is compact: each process takes one 16-byte row, each option it was given
+    // one 12-byte entry, and the values and command names are packed into a single string.
+    // The rows are sorted by PID. Scanning into the same table again reuses its storage.
+    class process_table
+    {
+        public:
+        // Returns the number of processes in the table.
+        //
+        //   * return (int) - The number of processes.
+        int size() const;
+
+        // Returns the PID of a process.
+        //
+        //   * int row - The row of the process.
+        //
+        //   * return (int) - The PID.
+        int pid(int row) const;
+
+        // Finds a process by PID.
+        //
+        //   * int pid - The PID.
+        //
+        //   * return (int) - The row of the process, or -1 if it is not in the table.
+        int find(int pid) const;
+
+        // Returns the command that a process runs: the first argument of its command line.
+        //
+        //   * int row - The row of the process.
+        //
+        //   * return (std::string_view) - The command, or an empty view for kernel threads.
+        std::string_view command(int row) const;
+
+        // Returns whether a process was given an option.
+        //
+        //   * int row    - The row of the process.
+        //   * int option - The id of the option in the schema.
+        //
+        //   * return (bool) - True if the process was given the option.
+        bool has(int row, int option) const;
+
+        // Returns the value of an option that a process was given.
+        //
+        //   * int row    - The row of the process.
+        //   * int option - The id of the option in the schema.
+        //
+        //   * return (std::string_view) - The value, or an empty view if the option has none.
+        std::string_view value(int row, int option) const;
+
+        // Removes every process, keeping the storage.
+        void clear();
+
+        private:
+        friend class process_scanner;
+
+        // An option that a process was given.
+        struct entry
+        {
+            // The id of the option in the schema.
+            int option;
+
+            // The value, as an offset and a length into text.
+            std::uint32_t value_begin;
+            std::uint32_t value_length;
+        };
+
+        // A process.
+        struct row
+        {
+            // The PID.
+            int pid;
+
+            // One past the last of the process's entries. Its first entry is where the previous row's end.
+            std::uint32_t entries_end;
+
+            // The command, as an offset and a length into text.
+            std::uint32_t command_begin;
+            std::uint32_t command_length;
+        };
+
+        // A helper method to find the entry of an option.
+        //
+        //   * int row    - The row of the process.
+        //   * int option - The id of the option in the schema.
+        //
+        //   * return (const entry *) - The entry, or nullptr.
+        const entry *find_entry(int row, int option) const;
+
+        // The processes, sorted by PID.
+        std::vector<row> rows;
+
+        // The options of every process, grouped by row.
+        std::vector<entry> entries;
+
+        // The values and commands.
+        std::string text;
+    };
+
+    // The argh::process_scanner class reads the command line of every process in /proc
+    // and classifies it against a schema of options.
+    //
+    //    argh::options schema;
+    //    int config = schema.add("--config", nullptr, "FILE");
+    //    int heap = schema.add("-Xmx", nullptr, "SIZE");
+    //
+    //    argh::process_scanner scanner(schema);
+    //    argh::process_table table;
+    //    scanner.scan(table);
+    //    for (int row = 0; row < table.size(); row++)
+    //    {
+    //        if (table.has(row, config))
+    //            report(table.pid(row), table.value(row, config));
+    //    }
+    //
+    // Options are found as the argh class finds them, with a few differences suited to
+    // command lines that the program did not write itself:
+    //    * Long options are resolved against the schema, so abbreviations are recognized.
+    //    * An option registered with a value name takes the following argument as its value,
+    //      unless it was given with '='. Other options never take a value.
+    //    * A single-dash option with a longer name, like "-Xmx", also matches arguments that
+    //      start with it, and the rest of the argument is its value: "-Xmx4g" gives "4g".
+    //    * When an option is given more than once, the last value wins.
+    //
+    // The scanner keeps a pool of threads, which split the processes between them, and
+    // each thread keeps its buffers from one scan to the next. After the first scan, a scan
+    // allocates only when a command line or a table is larger than any before.
+    // The schema is shared by the threads, so it must not change while a scan runs.
+    class process_scanner
+    {
+        public:
+        // The constructor, which starts the threads.
+        //
+        //   * const options &schema - The options to look for. It must outlive the scanner.
+        //   * int threads           - The number of threads to scan with, including the caller's.
+        //                             Zero means one per processor.
+        //   * std::string root      - The directory to read the processes from.
+        process_scanner(const options &schema, int threads = 0, std::string root = "/proc");
+
+        // The destructor, which stops the threads.
+        ~process_scanner();
+
+        process_scanner(const process_scanner &) = delete;
+        process_scanner &operator=(const process_scanner &) = delete;
+
+        // Scans every process, replacing the contents of the table.
+        // Processes that exit during the scan are left out.
+        //
+        //   * process_table &table - The table to store the processes in.
+        //
+        //   * return (bool) - True if the root directory could be read, false otherwise.
+        bool scan(process_table &table);
+
+        // Returns the number of threads that scan, including the caller's.
+        //
+        //   * return (int) - The number of threads.
+        int threads() const;
+
+        private:
+        // Where the results for one process are, in the buffers of the thread that read it.
+        struct slot
+        {
+            // The thread that read the process, or -1 if the process was gone.
+            int worker;
+
+            // The process's entries, as a range of the thread's entries.
+            std::uint32_t entries_begin;
+            std::uint32_t entries_end;
+
+            // The command, as an offset and a length into the thread's text.
+            std::uint32_t command_begin;
+            std::uint32_t command_length;
+        };
+
+        // Records the options of the schema that one process was given.
+        struct recorder;
+
+        // The buffers that each thread keeps between scans.
+        struct worker_state
+        {
+            // The command line being classified.
+            std::vector<char> buffer;
+
+            // The arguments of the command line being classified.
+            std::vector<std::string_view> arguments;
+
+            // The entries of the processes this thread read.
+            std::vector<process_table::entry> entries;
+
+            // The values and commands of the processes this thread read.
+            std::string text;
+
+            // Where text starts in the table's text, once the results are merged.
+            std::uint32_t base = 0;
+        };
+
+        // A helper method that the pool threads run.
+        //
+        //   * int worker - The index of the thread.
+        void run(int worker);
+
+        // A helper method to read and classify processes until none are left.
+        //
+        //   * int worker - The index of the thread.
+        void work(int worker);
+
+        // A helper method to read and classify one process.
+        //
+        //   * int worker    - The index of the thread.
+        //   * std::size_t i - The index of the process in pids.
+        void read_process(int worker, std::size_t i);
+
+        // A helper method to classify a command line.
+        //
+        //   * worker_state &state - The buffers of the thread, holding the arguments.
+        void classify(worker_state &state);
+
+        // The options to look for.
+        const options &schema;
+
+        // The single-dash options with longer names, which match arguments that start with them.
+        std::vector<int> attached;
+
+        // The directory to read the processes from.
+        std::string root;
+
+        // The root directory, open during a scan.
+        int root_fd = -1;
+
+        // The PIDs found in the root directory, sorted.
+        std::vector<int> pids;
+
+        // The results for each process, indexed like pids.
+        std::vector<slot> slots;
+
+        // The index in pids of the next batch of processes to read.
+        std::atomic<std::size_t> next;
+
+        // The buffers of each thread. The caller's thread is the first.
+        std::vector<worker_state> states;
+
+        // The pool threads.
+        std::vector<std::thread> pool;
+
+        // Guards generation, busy and stopping.
+        std::mutex lock;
+
+        // Wakes the pool threads when a scan starts or the scanner is destroyed.
+        std::condition_variable start;
+
+        // Wakes the caller when the pool threads are done.
+        std::condition_variable done;
+
+        // The number of scans started.
+        long int generation = 0;
+
+        // The number of pool threads still scanning.
+        int busy = 0;
+
+        // Whether the pool threads should exit.
+        bool stopping = false;
+    };
+}
+
+#endif
@@ -0,0 +1,257 @@
+// src/argh/scanner.h
+// v0.3.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the scanner headers.
+// Use this utility to stream the arguments into your own structures, without storing them.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef SCANNER_H
+#define SCANNER_H
+
+#include "options.h"
+#include "token.h"
+#include "utf8.h"
+
+#include <string_view>
+
+namespace argh
+{
+    // The argh::visitor struct lists the events that the scanner reports.
+    // Derive from it and hide the events you care about; the rest do nothing.
+    // The scanner takes the visitor as a template parameter, so the calls can be inlined.
+    //
+    // The views passed to the events are only valid during the call,
+    // unless they point into the scanned arguments themselves.
+    struct visitor
+    {
+        // Every non-empty argument, before it is reported as anything else.
+        //
+        //   * std::string_view arg - The argument.
+        //   * token_kind kind      - The kind of the argument. Arguments after "--" are positional.
+        void on_argument(std::string_view, token_kind) {}
+
+        // A flag: "--verbose", or each of "-a", "-b" and "-c" in "-abc".
+        //
+        //   * std::string_view name - The name of the flag.
+        void on_flag(std::string_view) {}
+
+        // A parameter given with '=': "--output=output.txt".
+        //
+        //   * std::string_view name  - The name of the parameter.
+        //   * std::string_view value - The value of the parameter.
+        void on_parameter(std::string_view, std::string_view) {}
+
+        // A positional argument. If it directly follows a flag, it may be that flag's value instead;
+        // the flag is then given as its owner.
+        //
+        //   * std::string_view value - The positional argument.
+        //   * std::string_view owner - The flag that might own it, or an empty view.
+        void on_positional(std::string_view, std::string_view) {}
+
+        // A double dash: "--". All following arguments are positional.
+        void on_double_dash() {}
+
+        // A long option that abbreviates more than one registered option.
+        //
+        //   * std::string_view name - The option, as given.
+        void on_ambiguous(std::string_view) {}
+
+        // An argument that failed validation, when the registry asks for it. It is not reported as anything else.
+        //
+        //   * std::string_view arg - The argument.
+        //   * text_problem problem - What is wrong with it.
+        void on_invalid(std::string_view, text_problem) {}
+    };
+
+    // The argh::scanner class classifies arguments one at a time and reports them to a visitor.
+    // This is the same logic that the argh class uses to fill its containers.
+    //
+    //    struct counter : argh::visitor
+    //    {
+    //        int flags = 0;
+    //        void on_flag(std::string_view) { flags++; }
+    //    };
+    //
+    //    counter count;
+    //    argh::visit(argc, argv, count);
+    //
+    // The scanner keeps a view of the last long option, so the arguments must outlive the scan.
+    // A copy of a scanner carries on from the same state, independently of the original.
+    class scanner
+    {
+        public:
+        // The constructor.
+        //
+        //   * const options *registry - The registry to resolve long options against, or nullptr.
+        explicit scanner(const options *registry = nullptr) : registry(registry)
+        {
+        }
+
+        // Classifies a single argument and reports it.
+        //
+        //   * std::string_view arg - The argument.
+        //   * visitor_type &v      - The visitor.
+        template <typename visitor_type>
+        void scan(std::string_view arg, visitor_type &v);
+
+        private:
+        // A helper method to resolve an option name against the registry, if there is one.
+        //
+        //   * std::string_view name - The name of the option, as given.
+        //   * visitor_type &v       - The visitor, told about ambiguous names.
+        //
+        //   * return (std::string_view) - The full name of the option, or the name as given.
+        template <typename visitor_type>
+        std::string_view resolve(std::string_view name, visitor_type &v);
+
+        // The registry to resolve long options against, or nullptr.
+        const options *registry;
+
+        // Returns the name of the flag that the last argument ended with, which might own the next one.
+        //
+        //   * return (std::string_view) - The name of the flag, or an empty view.
+        std::string_view last_flag() const
+        {
+            return this->last_was_short ? std::string_view(this->short_flag, 2) : this->last_long;
+        }
+
+        // If the last argument was a long option, this is its name, as a view into the argument or the registry.
+        std::string_view last_long;
+
+        // Whether the last argument was a cluster of short flags, whose last flag is in short_flag.
+        // It is a flag rather than a view into short_flag, so that a copy of the scanner doesn't
+        // point into the original's storage.
+        bool last_was_short = false;
+
+        // The storage for the name of the last short flag.
+        char short_flag[2] = {'-', '\0'};
+
+        // Whether we've seen "--" in the arguments.
+        bool double_dash_set = false;
+    };
+
+    // Classifies a single argument and reports it.
+    //
+    //   * std::string_view arg - The argument.
+    //   * visitor_type &v      - The visitor.
+    template <typename visitor_type>
+    inline void scanner::scan(std::string_view arg, visitor_type &v)
+    {
+        token tok = classify(arg);
+
+        // Make sure the argument is not empty.
+        if (tok.kind == token_kind::empty)
+            return;
+
+        // Reject invalid text before any of it is stored.
+        if (this->registry != nullptr && this->registry->validates_text())
+        {
+            text_problem problem = check_text(arg);
+            if (problem != text_problem::none)
+            {
+                this->last_long = std::string_view();
+                this->last_was_short = false;
+                v.on_invalid(arg, problem);
+                return;
+            }
+        }
+
+        // If we've seen a double dash, we're parsing positional arguments.
+        if (this->double_dash_set)
+        {
+            v.on_argument(arg, token_kind::positional);
+            v.on_positional(arg, std::string_view());
+            return;
+        }
+
+        v.on_argument(arg, tok.kind);
+        switch (tok.kind)
+        {
+        case token_kind::double_dash:
+            // A double dash means that all following arguments are positional arguments.
+            this->double_dash_set = true;
+            this->last_long = std::string_view();
+            this->last_was_short = false;
+            v.on_double_dash();
+            return;
+
+        case token_kind::dash:
+        case token_kind::positional:
+            // The argument is either the value of a parameter or a positional argument.
+            v.on_positional(arg, last_flag());
+            this->last_long = std::string_view();
+            this->last_was_short = false;
+            return;
+
+        case token_kind::short_with_value:
+        case token_kind::long_with_value:
+            // An option with '=' is a parameter.
+            v.on_parameter(resolve(arg.substr(0, tok.name_end), v), arg.substr(tok.value_begin));
+            this->last_long = std::string_view();
+            this->last_was_short = false;
+            return;
+
+        case token_kind::long_option:
+            this->last_long = resolve(arg, v);
+            this->last_was_short = false;
+            v.on_flag(this->last_long);
+            return;
+
+        default:
+            // Treat each character following the single dash as a flag.
+            for (long unsigned int i = 1; i < arg.length(); i++)
+            {
+                this->short_flag[1] = arg[i];
+                v.on_flag(std::string_view(this->short_flag, 2));
+            }
+            this->last_long = std::string_view();
+            this->last_was_short = true;
+            return;
+        }
+    }
+
+    // A helper method to resolve an option name against the registry, if there is one.
+    // Unregistered names are kept as given; ambiguous abbreviations are also reported.
+    //
+    //   * std::string_view name - The name of the option, as given.
+    //   * visitor_type &v       - The visitor, told about ambiguous names.
+    //
+    //   * return (std::string_view) - The full name of the option, or the name as given.
+    template <typename visitor_type>
+    inline std::string_view scanner::resolve(std::string_view name, visitor_type &v)
+    {
+        if (this->registry == nullptr)
+            return name;
+
+        int id = this->registry->find(name);
+        if (id == options::ambiguous)
+        {
+            v.on_ambiguous(name);
+            return name;
+        }
+        if (id == options::not_found)
+            return name;
+        return this->registry->name(id);
+    }
+
+    // Scans the argv vector that main receives, skipping the program name.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments.
+    //   * visitor_type &v         - The visitor.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    template <typename visitor_type>
+    inline void visit(int argc, char *argv[], visitor_type &v, const options *registry = nullptr)
+    {
+        scanner scan(registry);
+        for (int i = 1; i < argc; i++)
+            scan.scan(argv[i], v);
+    }
+}
+
+#endif
@@ -0,0 +1,252 @@
+// src/argh/small_vector.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the small_vector class.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace argh
+{
+    // A vector that keeps its first N elements inline, and only allocates once it grows past them.
+    // The elements must be trivially copyable, so that they can be moved with memcpy.
+    // Unlike std::vector, resizing and growing leave new elements uninitialized.
+    template <typename T, std::size_t N>
+    class small_vector
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "small_vector only holds trivially copyable types");
+        static_assert(N > 0, "small_vector needs some inline capacity");
+
+        public:
+        // The zero-argument constructor that creates an empty vector.
+        small_vector() : heap(nullptr), count(0), room(N)
+        {
+        }
+
+        // The copy constructor.
+        //
+        //   * const small_vector &other - The vector to copy.
+        small_vector(const small_vector &other) : small_vector()
+        {
+            append(other.data(), other.size());
+        }
+
+        // The move constructor. A spilled vector hands over its heap storage.
+        //
+        //   * small_vector &&other - The vector to move from. It is left empty.
+        small_vector(small_vector &&other) noexcept : small_vector()
+        {
+            take(other);
+        }
+
+        // The destructor.
+        ~small_vector()
+        {
+            delete[] this->heap;
+        }
+
+        // The copy assignment operator.
+        //
+        //   * const small_vector &other - The vector to copy.
+        small_vector &operator=(const small_vector &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                append(other.data(), other.size());
+            }
+            return *this;
+        }
+
+        // The move assignment operator.
+        //
+        //   * small_vector &&other - The vector to move from. It is left empty.
+        small_vector &operator=(small_vector &&other) noexcept
+        {
+            if (this != &other)
+            {
+                delete[] this->heap;
+                this->heap = nullptr;
+                this->count = 0;
+                this->room = N;
+                take(other);
+            }
+            return *this;
+        }
+
+        // Appends an element. It is taken by value, so it may be one of this vector's own elements.
+        //
+        //   * T value - The element.
+        void push_back(T value)
+        {
+            if (this->count == this->room)
+                grow(this->count + 1);
+            data()[this->count++] = value;
+        }
+
+        // Appends a run of elements.
+        //
+        //   * const T *values  - The elements.
+        //   * std::size_t size - The number of elements.
+        void append(const T *values, std::size_t size)
+        {
+            if (this->count + size > this->room)
+                grow(this->count + size);
+            if (size > 0)
+                std::memcpy(data() + this->count, values, size * sizeof(T));
+            this->count += size;
+        }
+
+        // Makes sure that the vector can hold a number of elements without allocating again.
+        //
+        //   * std::size_t capacity - The number of elements.
+        void reserve(std::size_t capacity)
+        {
+            if (capacity > this->room)
+                grow(capacity);
+        }
+
+        // Changes the number of elements. New elements are left uninitialized.
+        //
+        //   * std::size_t size - The number of elements.
+        void resize(std::size_t size)
+        {
+            reserve(size);
+            this->count = size;
+        }
+
+        // Removes every element, but keeps the storage.
+        void clear()
+        {
+            this->count = 0;
+        }
+
+        // Returns the elements.
+        //
+        //   * return (T *) - The first element.
+        T *data()
+        {
+            return this->heap != nullptr ? this->heap : this->inline_elements;
+        }
+
+        // Returns the elements.
+        //
+        //   * return (const T *) - The first element.
+        const T *data() const
+        {
+            return this->heap != nullptr ? this->heap : this->inline_elements;
+        }
+
+        // Returns the number of elements.
+        //
+        //   * return (std::size_t) - The number of elements.
+        std::size_t size() const
+        {
+            return this->count;
+        }
+
+        // Returns the number of elements that fit before the vector allocates again.
+        //
+        //   * return (std::size_t) - The capacity.
+        std::size_t capacity() const
+        {
+            return this->room;
+        }
+
+        // Returns whether the vector has outgrown its inline storage.
+        //
+        //   * return (bool) - Whether the elements are on the heap.
+        bool spilled() const
+        {
+            return this->heap != nullptr;
+        }
+
+        // Overload the [] operator to access an element.
+        //
+        //   * std::size_t index - The index of the element.
+        //
+        //   * return (T &) - The element.
+        T &operator[](std::size_t index)
+        {
+            return data()[index];
+        }
+
+        // Overload the [] operator to access an element.
+        //
+        //   * std::size_t index - The index of the element.
+        //
+        //   * return (const T &) - The element.
+        const T &operator[](std::size_t index) const
+        {
+            return data()[index];
+        }
+
+        T *begin() { return data(); }
+        T *end() { return data() + this->count; }
+        const T *begin() const { return data(); }
+        const T *end() const { return data() + this->count; }
+
+        private:
+        // Moves the storage to the heap, with room for at least the given number of elements.
+        //
+        //   * std::size_t needed - The number of elements.
+        void grow(std::size_t needed)
+        {
+            std::size_t capacity = this->room * 2;
+            if (capacity < needed)
+                capacity = needed;
+
+            T *elements = new T[capacity];
+            if (this->count > 0)
+                std::memcpy(elements, data(), this->count * sizeof(T));
+            delete[] this->heap;
+            this->heap = elements;
+            this->room = capacity;
+        }
+
+        // Takes the elements of another vector, which is left empty.
+        // Only called while this vector is empty and inline.
+        //
+        //   * small_vector &other - The vector to take from.
+        void take(small_vector &other)
+        {
+            if (other.heap != nullptr)
+            {
+                this->heap = std::exchange(other.heap, nullptr);
+                this->room = std::exchange(other.room, N);
+                this->count = std::exchange(other.count, 0);
+            }
+            else
+            {
+                append(other.data(), other.size());
+                other.count = 0;
+            }
+        }
+
+        // The elements, once they have spilled to the heap; otherwise nullptr.
+        T *heap;
+
+        // The number of elements.
+        std::size_t count;
+
+        // The number of elements that fit in the current storage.
+        std::size_t room;
+
+        // The inline storage.
+        T inline_elements[N];
+    };
+}
+
+#endif
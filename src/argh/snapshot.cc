@@ -0,0 +1,375 @@
+// src/argh/snapshot.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the snapshot class.
+// Use this utility to share parsed arguments with forked workers without copying them.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "snapshot.h"
+
+#include "argh.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace argh
+{
+    namespace
+    {
+        // The first four bytes of every region: "ARGH", little-endian.
+        constexpr std::uint32_t snapshot_magic = 0x48475241;
+
+        // The seals that attach requires, so that the region can neither change nor shrink.
+        constexpr int required_seals = F_SEAL_WRITE | F_SEAL_SHRINK;
+    }
+
+    // The zero-argument constructor that creates an empty snapshot.
+    snapshot::snapshot()
+    {
+    }
+
+    // The destructor, which unmaps the region.
+    snapshot::~snapshot()
+    {
+        release();
+    }
+
+    // The move constructor.
+    //
+    //   * snapshot &&other - The snapshot to move from. It is left empty.
+    snapshot::snapshot(snapshot &&other) noexcept
+        : region(std::exchange(other.region, nullptr)), length(std::exchange(other.length, 0)),
+          memfd(std::exchange(other.memfd, -1))
+    {
+    }
+
+    // The move assignment operator.
+    //
+    //   * snapshot &&other - The snapshot to move from. It is left empty.
+    snapshot &snapshot::operator=(snapshot &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            this->region = std::exchange(other.region, nullptr);
+            this->length = std::exchange(other.length, 0);
+            this->memfd = std::exchange(other.memfd, -1);
+        }
+        return *this;
+    }
+
+    // Lays out an argh instance in a new read-only region, replacing the current one.
+    // The region is written through a temporary writable mapping, which is removed before
+    // the memfd is sealed against writes and mapped again read-only. The read-only mapping
+    // is populated up front, so that forked workers find every page already shared.
+    //
+    //   * const argh &args - The parsed arguments.
+    //
+    //   * return (bool) - True if the region was created, false otherwise.
+    bool snapshot::publish(const argh &args)
+    {
+        argh::flag_range flags = args.flags();
+        argh::parameter_range parameters = args.parameters();
+        argh::positional_range positionals = args.positionals();
+
+        // Sort the names, so that the workers can binary search them.
+        std::vector<std::string_view> flag_names(flags.begin(), flags.end());
+        std::sort(flag_names.begin(), flag_names.end());
+        std::vector<parameter_entry> parameter_entries(parameters.begin(), parameters.end());
+        std::sort(parameter_entries.begin(), parameter_entries.end(),
+                  [](const parameter_entry &a, const parameter_entry &b) { return a.name < b.name; });
+
+        std::size_t text_length = 0;
+        for (std::string_view name : flag_names)
+            text_length += name.length();
+        for (const parameter_entry &entry : parameter_entries)
+            text_length += entry.name.length() + entry.value.length();
+        for (std::string_view value : positionals)
+            text_length += value.length();
+
+        header layout;
+        layout.magic = snapshot_magic;
+        layout.flags = sizeof(header);
+        layout.flag_count = flag_names.size();
+        layout.parameters = layout.flags + layout.flag_count * sizeof(text_ref);
+        layout.parameter_count = parameter_entries.size();
+        layout.positionals = layout.parameters + layout.parameter_count * sizeof(parameter_ref);
+        layout.positional_count = positionals.size();
+        layout.text = layout.positionals + layout.positional_count * sizeof(text_ref);
+        layout.text_length = text_length;
+        std::size_t bytes = (std::size_t)layout.text + text_length;
+        if (bytes > UINT32_MAX)
+            return false;
+        layout.bytes = bytes;
+
+        int fd = memfd_create("argh_snapshot", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd == -1)
+            return false;
+        if (ftruncate(fd, bytes) == -1)
+        {
+            close(fd);
+            return false;
+        }
+        void *writable = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (writable == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+
+        unsigned char *start = (unsigned char *)writable;
+        std::uint32_t next = 0;
+        char *text = (char *)start + layout.text;
+        auto write = [&](std::string_view s) {
+            std::memcpy(text + next, s.data(), s.length());
+            text_ref ref{next, (std::uint32_t)s.length()};
+            next += s.length();
+            return ref;
+        };
+
+        std::memcpy(start, &layout, sizeof(header));
+        text_ref *flag_refs = (text_ref *)(start + layout.flags);
+        for (std::size_t i = 0; i < flag_names.size(); i++)
+            flag_refs[i] = write(flag_names[i]);
+        parameter_ref *parameter_refs = (parameter_ref *)(start + layout.parameters);
+        for (std::size_t i = 0; i < parameter_entries.size(); i++)
+        {
+            parameter_refs[i].name = write(parameter_entries[i].name);
+            parameter_refs[i].value = write(parameter_entries[i].value);
+        }
+        text_ref *positional_refs = (text_ref *)(start + layout.positionals);
+        for (std::size_t i = 0; i < positionals.size(); i++)
+            positional_refs[i] = write(positionals[i]);
+        munmap(writable, bytes);
+
+        // With the writable mapping gone, the region can be sealed for good.
+        if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == -1)
+        {
+            close(fd);
+            return false;
+        }
+        void *readable = mmap(nullptr, bytes, PROT_READ, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (readable == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+
+        release();
+        this->region = (const unsigned char *)readable;
+        this->length = bytes;
+        this->memfd = fd;
+        return true;
+    }
+
+    // Maps a region published by another process, replacing the current one.
+    // Only a memfd sealed against writes and shrinking is accepted.
+    //
+    //   * int fd - The descriptor, as returned by fd() in the publishing process. It is duplicated.
+    //
+    //   * return (bool) - True if the region was mapped, false otherwise.
+    bool snapshot::attach(int fd)
+    {
+        // A region that could still be written or truncated might change under the readers.
+        int seals = fcntl(fd, F_GET_SEALS);
+        if (seals == -1 || (seals & required_seals) != required_seals)
+            return false;
+
+        struct stat info;
+        if (fstat(fd, &info) == -1 || (std::size_t)info.st_size < sizeof(header))
+            return false;
+        std::size_t bytes = info.st_size;
+
+        void *readable = mmap(nullptr, bytes, PROT_READ, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (readable == MAP_FAILED)
+            return false;
+        if (!valid((const unsigned char *)readable, bytes))
+        {
+            munmap(readable, bytes);
+            return false;
+        }
+        int copy = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+        if (copy == -1)
+        {
+            munmap(readable, bytes);
+            return false;
+        }
+
+        release();
+        this->region = (const unsigned char *)readable;
+        this->length = bytes;
+        this->memfd = copy;
+        return true;
+    }
+
+    // Returns the descriptor of the region, for passing to attach in another process.
+    //
+    //   * return (int) - The descriptor, or -1 if the snapshot is empty.
+    int snapshot::fd() const
+    {
+        return this->memfd;
+    }
+
+    // Returns the size of the region.
+    //
+    //   * return (std::size_t) - The size of the region, in bytes.
+    std::size_t snapshot::bytes() const
+    {
+        return this->length;
+    }
+
+    // Returns the address of the region, so that its memory use can be measured.
+    //
+    //   * return (const void *) - The start of the region, or nullptr if the snapshot is empty.
+    const void *snapshot::data() const
+    {
+        return this->region;
+    }
+
+    // Checks for a flag, as argh::has_flag does.
+    //
+    //   * std::string_view name - The name of the flag.
+    //
+    //   * return (bool) - The value of the flag.
+    bool snapshot::has_flag(std::string_view name) const
+    {
+        if (this->region == nullptr)
+            return false;
+        const text_ref *begin = (const text_ref *)(this->region + head().flags);
+        const text_ref *end = begin + head().flag_count;
+        const text_ref *found = std::lower_bound(begin, end, name,
+                                                 [this](text_ref ref, std::string_view n) { return read(ref) < n; });
+        return found != end && read(*found) == name;
+    }
+
+    // Finds the value of a parameter, as argh::parameter_value does.
+    //
+    //   * std::string_view name - The name of the parameter.
+    //
+    //   * return (std::string_view) - The value of the parameter, or an empty view.
+    std::string_view snapshot::parameter_value(std::string_view name) const
+    {
+        if (this->region == nullptr)
+            return std::string_view();
+        const parameter_ref *begin = (const parameter_ref *)(this->region + head().parameters);
+        const parameter_ref *end = begin + head().parameter_count;
+        const parameter_ref *found = std::lower_bound(
+            begin, end, name, [this](const parameter_ref &ref, std::string_view n) { return read(ref.name) < n; });
+        if (found == end || read(found->name) != name)
+            return std::string_view();
+        return read(found->value);
+    }
+
+    // Finds a positional argument, as argh::positional does.
+    //
+    //   * int index - The index of the positional argument.
+    //
+    //   * return (std::string_view) - The positional argument, or an empty view.
+    std::string_view snapshot::positional(int index) const
+    {
+        if (index < 0 || index >= size())
+            return std::string_view();
+        return read(((const text_ref *)(this->region + head().positionals))[index]);
+    }
+
+    // Returns the number of positional arguments.
+    //
+    //   * return (int) - The number of positional arguments.
+    int snapshot::size() const
+    {
+        if (this->region == nullptr)
+            return 0;
+        return head().positional_count;
+    }
+
+    // A helper method to check a region before using it.
+    //
+    //   * const unsigned char *start - The start of the region.
+    //   * std::size_t length         - The size of the mapping.
+    //
+    //   * return (bool) - True if every offset and string is inside the region.
+    bool snapshot::valid(const unsigned char *start, std::size_t length)
+    {
+        header layout;
+        std::memcpy(&layout, start, sizeof(header));
+        if (layout.magic != snapshot_magic || layout.bytes != length)
+            return false;
+
+        // Each table must follow the one before it, and the text must end the region.
+        auto table_end = [](std::uint32_t offset, std::uint32_t count, std::size_t size) {
+            return (std::uint64_t)offset + (std::uint64_t)count * size;
+        };
+        if (layout.flags != sizeof(header) ||
+            layout.parameters != table_end(layout.flags, layout.flag_count, sizeof(text_ref)) ||
+            layout.positionals != table_end(layout.parameters, layout.parameter_count, sizeof(parameter_ref)) ||
+            layout.text != table_end(layout.positionals, layout.positional_count, sizeof(text_ref)) ||
+            (std::uint64_t)layout.text + layout.text_length != length)
+            return false;
+
+        auto inside = [&](text_ref ref) { return (std::uint64_t)ref.begin + ref.length <= layout.text_length; };
+        const text_ref *refs = (const text_ref *)(start + layout.flags);
+        for (std::uint32_t i = 0; i < layout.flag_count; i++)
+        {
+            if (!inside(refs[i]))
+                return false;
+        }
+        const parameter_ref *parameter_refs = (const parameter_ref *)(start + layout.parameters);
+        for (std::uint32_t i = 0; i < layout.parameter_count; i++)
+        {
+            if (!inside(parameter_refs[i].name) || !inside(parameter_refs[i].value))
+                return false;
+        }
+        refs = (const text_ref *)(start + layout.positionals);
+        for (std::uint32_t i = 0; i < layout.positional_count; i++)
+        {
+            if (!inside(refs[i]))
+                return false;
+        }
+        return true;
+    }
+
+    // A helper method to unmap the region and close its descriptor.
+    void snapshot::release()
+    {
+        if (this->region != nullptr)
+            munmap((void *)this->region, this->length);
+        if (this->memfd != -1)
+            close(this->memfd);
+        this->region = nullptr;
+        this->length = 0;
+        this->memfd = -1;
+    }
+
+    // A helper method to access the header.
+    //
+    //   * return (const header &) - The header.
+    const snapshot::header &snapshot::head() const
+    {
+        return *(const header *)this->region;
+    }
+
+    // A helper method to read a string from the region.
+    //
+    //   * text_ref ref - The string.
+    //
+    //   * return (std::string_view) - The string.
+    std::string_view snapshot::read(text_ref ref) const
+    {
+        return std::string_view((const char *)this->region + head().text + ref.begin, ref.length);
+    }
+}
@@ -0,0 +1,203 @@
+// src/argh/snapshot.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the snapshot headers.
+// Use this utility to share parsed arguments with forked workers without copying them.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "argh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace argh
+{
+    // The argh::snapshot class is a read-only copy of a parsed argh instance, for prefork servers.
+    //
+    // Forked workers share the master's memory until one of them writes to a page, which
+    // the kernel then copies for that worker alone. Querying an argh instance can write to it
+    // (the () operator removes the positional arguments that a parameter owns), and so can
+    // anything that copies it. A snapshot can't be written to at all: publish lays out the flags,
+    // parameters and positional arguments in one contiguous region, with offsets instead of
+    // pointers, in a sealed memfd mapped read-only. Every worker reads the same physical pages.
+    //
+    //    argh::argh args(argc, argv);
+    //    args.mark_parameter("--config");
+    //
+    //    argh::snapshot options;
+    //    options.publish(args);
+    //    for (int i = 0; i < workers; i++)
+    //    {
+    //        if (fork() == 0)
+    //            return serve(options.parameter_value("--config"));
+    //    }
+    //
+    // A snapshot records the positional arguments as they are when it is published,
+    // so mark the parameters first. Its queries never remove positional arguments.
+    // A worker that execs can also attach to the snapshot by its file descriptor.
+    class snapshot
+    {
+        public:
+        // The zero-argument constructor that creates an empty snapshot.
+        snapshot();
+
+        // The destructor, which unmaps the region.
+        ~snapshot();
+
+        // The move constructor.
+        //
+        //   * snapshot &&other - The snapshot to move from. It is left empty.
+        snapshot(snapshot &&other) noexcept;
+
+        // The move assignment operator.
+        //
+        //   * snapshot &&other - The snapshot to move from. It is left empty.
+        snapshot &operator=(snapshot &&other) noexcept;
+
+        snapshot(const snapshot &) = delete;
+        snapshot &operator=(const snapshot &) = delete;
+
+        // Lays out an argh instance in a new read-only region, replacing the current one.
+        //
+        //   * const argh &args - The parsed arguments.
+        //
+        //   * return (bool) - True if the region was created, false otherwise.
+        bool publish(const argh &args);
+
+        // Maps a region published by another process, replacing the current one.
+        // The descriptor must be sealed against writes and shrinking, as publish seals it, so that
+        // the region can't change while it is read. The region is also checked before it is used,
+        // so a bad descriptor can't cause out-of-bounds reads.
+        //
+        //   * int fd - The descriptor, as returned by fd() in the publishing process. It is duplicated.
+        //
+        //   * return (bool) - True if the region was mapped, false otherwise.
+        bool attach(int fd);
+
+        // Returns the descriptor of the region, for passing to attach in another process.
+        //
+        //   * return (int) - The descriptor, or -1 if the snapshot is empty.
+        int fd() const;
+
+        // Returns the size of the region.
+        //
+        //   * return (std::size_t) - The size of the region, in bytes.
+        std::size_t bytes() const;
+
+        // Returns the address of the region, so that its memory use can be measured.
+        //
+        //   * return (const void *) - The start of the region, or nullptr if the snapshot is empty.
+        const void *data() const;
+
+        // Checks for a flag, as argh::has_flag does.
+        //
+        //   * std::string_view name - The name of the flag.
+        //
+        //   * return (bool) - The value of the flag.
+        bool has_flag(std::string_view name) const;
+
+        // Finds the value of a parameter, as argh::parameter_value does.
+        // The value points into the region, so it is valid for as long as the snapshot is.
+        //
+        //   * std::string_view name - The name of the parameter.
+        //
+        //   * return (std::string_view) - The value of the parameter, or an empty view.
+        std::string_view parameter_value(std::string_view name) const;
+
+        // Finds a positional argument, as argh::positional does.
+        //
+        //   * int index - The index of the positional argument.
+        //
+        //   * return (std::string_view) - The positional argument, or an empty view.
+        std::string_view positional(int index) const;
+
+        // Returns the number of positional arguments.
+        //
+        //   * return (int) - The number of positional arguments.
+        int size() const;
+
+        private:
+        // A string in the region, as an offset from the start of the text and a length.
+        struct text_ref
+        {
+            std::uint32_t begin;
+            std::uint32_t length;
+        };
+
+        // A parameter in the region.
+        struct parameter_ref
+        {
+            text_ref name;
+            text_ref value;
+        };
+
+        // The start of the region. Every offset is from the start of the region, except text_ref's.
+        struct header
+        {
+            // Identifies a region as a snapshot.
+            std::uint32_t magic;
+
+            // The size of the region, in bytes.
+            std::uint32_t bytes;
+
+            // The flags, sorted by name.
+            std::uint32_t flags;
+            std::uint32_t flag_count;
+
+            // The parameters, sorted by name.
+            std::uint32_t parameters;
+            std::uint32_t parameter_count;
+
+            // The positional arguments, in order.
+            std::uint32_t positionals;
+            std::uint32_t positional_count;
+
+            // The characters of every string.
+            std::uint32_t text;
+            std::uint32_t text_length;
+        };
+
+        // A helper method to check a region before using it.
+        //
+        //   * const unsigned char *start - The start of the region.
+        //   * std::size_t length         - The size of the mapping.
+        //
+        //   * return (bool) - True if every offset and string is inside the region.
+        static bool valid(const unsigned char *start, std::size_t length);
+
+        // A helper method to unmap the region and close its descriptor.
+        void release();
+
+        // A helper method to access the header.
+        //
+        //   * return (const header &) - The header.
+        const header &head() const;
+
+        // A helper method to read a string from the region.
+        //
+        //   * text_ref ref - The string.
+        //
+        //   * return (std::string_view) - The string.
+        std::string_view read(text_ref ref) const;
+
+        // The start of the region, or nullptr.
+        const unsigned char *region = nullptr;
+
+        // The size of the mapping.
+        std::size_t length = 0;
+
+        // The memfd that holds the region, or -1.
+        int memfd = -1;
+    };
+}
+
+#endif
@@ -0,0 +1,73 @@
+// src/argh/stats.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the parse statistics.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "stats.h"
+#include "config.h"
+#include "token.h"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+namespace argh
+{
+    // The names of the kinds of tokens, as they appear in the log line.
+    ARGH_INLINE constexpr const char *token_kind_names[token_kind_count] = {
+        "empty", "dash", "double_dash", "short_cluster",
+        "short_with_value", "long_option", "long_with_value", "positional"};
+
+    // Counts a copy of a string into a std::string of its own.
+    // It allocates unless it fits in the small-string buffer.
+    //
+    //   * std::string_view copy - The copied string.
+    ARGH_INLINE void parse_stats::copied(std::string_view copy)
+    {
+        static const long unsigned int small_capacity = std::string().capacity();
+
+        this->bytes_copied += copy.length();
+        if (copy.length() > small_capacity)
+            this->allocations++;
+    }
+
+    // Renders the statistics as a single log line of space-separated key=value pairs.
+    //
+    //   * return (std::string) - The log line.
+    ARGH_INLINE std::string parse_stats::to_string() const
+    {
+        std::string line = "argh:";
+        for (int kind = 0; kind < token_kind_count; kind++)
+            line += std::string(" tokens.") + token_kind_names[kind] + "=" + std::to_string(this->tokens[kind]);
+        line += " bytes_copied=" + std::to_string(this->bytes_copied);
+        line += " allocations=" + std::to_string(this->allocations);
+        line += " rehashes=" + std::to_string(this->rehashes);
+        line += " mark_parameter_scans=" + std::to_string(this->mark_parameter_scans);
+        line += " queries=" + std::to_string(this->queries);
+        line += " constructor_ns=" + std::to_string(this->constructor_ns);
+        line += " query_ns=" + std::to_string(this->query_ns);
+        return line;
+    }
+
+    // The one-argument constructor that starts the timer.
+    //
+    //   * long int &target - The counter to add the elapsed nanoseconds to.
+    ARGH_INLINE stats_timer::stats_timer(long int &target) : target(target)
+    {
+        this->start = std::chrono::steady_clock::now();
+    }
+
+    // The destructor stops the timer.
+    ARGH_INLINE stats_timer::~stats_timer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - this->start;
+        this->target += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+}
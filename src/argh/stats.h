@@ -0,0 +1,105 @@
+// src/argh/stats.h
+// v0.2.1
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the parse statistics headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "token.h"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+// Statistics are only collected when ARGH_STATS is defined, which the //argh:argh_stats
+// target does for argh.cc alone. Otherwise, every statement wrapped in ARGH_STAT compiles
+// to nothing. The layout of the argh class is the same either way.
+#ifdef ARGH_STATS
+#define ARGH_STAT(...) __VA_ARGS__
+#else
+#define ARGH_STAT(...)
+#endif
+
+namespace argh
+{
+    // The statistics that an argh instance collects about itself.
+    //
+    // The allocation count is worked out from the outside of the containers, for each way of
+    // storing the arguments: the text buffer when it outgrows its inline capacity (copied
+    // arguments only), the shared vector of an instance that owns its strings, every growth
+    // of a container past its inline capacity or of a hash table, and every string the
+    // instance copies for itself that is too long for the small-string buffer. Borrowed and
+    // owned arguments are never copied, so they add nothing to bytes_copied. The shared
+    // table of interned names belongs to the process, not to the instance, and isn't counted;
+    // of the instance's own table of names that didn't fit in it, only the names are.
+    struct parse_stats
+    {
+        // The number of tokens parsed, indexed by token_kind.
+        long int tokens[token_kind_count] = {};
+
+        // The number of bytes copied out of the argv vector, into the text buffer or into strings.
+        long int bytes_copied = 0;
+
+        // The estimated number of heap allocations made while parsing.
+        long int allocations = 0;
+
+        // The number of times a hash table grew its buckets.
+        long int rehashes = 0;
+
+        // The number of positional arguments compared by mark_parameter.
+        long int mark_parameter_scans = 0;
+
+        // The number of queries answered.
+        long int queries = 0;
+
+        // The time spent in the constructor, in nanoseconds.
+        long int constructor_ns = 0;
+
+        // The time spent answering queries, in nanoseconds.
+        long int query_ns = 0;
+
+        // Counts a copy of a string into a std::string of its own.
+        //
+        //   * std::string_view copy - The copied string.
+        void copied(std::string_view copy);
+
+        // Renders the statistics as a single log line of space-separated key=value pairs.
+        //
+        //   * return (std::string) - The log line.
+        std::string to_string() const;
+    };
+
+    // Adds the time between its construction and its destruction to a counter.
+    class stats_timer
+    {
+        public:
+        // The one-argument constructor that starts the timer.
+        //
+        //   * long int &target - The counter to add the elapsed nanoseconds to.
+        stats_timer(long int &target);
+
+        // The destructor stops the timer.
+        ~stats_timer();
+
+        private:
+        // The counter to add the elapsed nanoseconds to.
+        long int &target;
+
+        // The time that the timer started.
+        std::chrono::steady_clock::time_point start;
+    };
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "stats.cc"
+#endif
+
+#endif
@@ -0,0 +1,217 @@
+// src/argh/subcommand.cc
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the subcommand utility.
+// Use this utility to dispatch command lines like "prg do_a_thing -abc".
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "subcommand.h"
+#include "argh.h"
+#include "options.h"
+#include "trie.h"
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argh
+{
+    namespace
+    {
+        // Checks whether an option takes the next argument as its value.
+        // A long option is looked up as it is, abbreviations included; in a cluster
+        // of short options, only the last one can take a value.
+        //
+        //   * const options *opts  - The registry of the current level, or nullptr.
+        //   * std::string_view arg  - The option.
+        //
+        //   * return (bool) - True if the registry gives the option a value name.
+        bool takes_value(const options *opts, std::string_view arg)
+        {
+            if (opts == nullptr || arg.find('=') != std::string_view::npos)
+                return false;
+            int id = arg.starts_with("--") ? opts->find(arg) : opts->find(std::string{'-', arg.back()});
+            return id >= 0 && opts->value_name(id) != nullptr;
+        }
+    }
+
+    // The zero-argument constructor that creates a tree with only the root command.
+    command_tree::command_tree()
+    {
+        this->commands.push_back({"", -1, trie(), nullptr});
+    }
+
+    // Registers a subcommand. Registering a name again under the same parent
+    // returns the id it already has, as options::add does.
+    //
+    //   * std::string name - The name of the subcommand.
+    //   * int parent       - The id of the parent command.
+    //
+    //   * return (int) - The id of the subcommand, or -1 if there is no such parent.
+    int command_tree::add(std::string name, int parent)
+    {
+        if (!exists(parent))
+            return -1;
+        int existing = this->commands[parent].children.find(name);
+        if (existing != trie::not_found)
+            return existing;
+
+        int id = this->commands.size();
+        this->commands[parent].children.insert(name, id);
+        this->commands.push_back({name, parent, trie(), nullptr});
+        return id;
+    }
+
+    // Registers a subcommand, as above, with a registry of its options.
+    //
+    //   * std::string name    - The name of the subcommand.
+    //   * int parent          - The id of the parent command.
+    //   * const options &opts - The registry of the subcommand's options. It must outlive the tree.
+    //
+    //   * return (int) - The id of the subcommand, or -1 if there is no such parent.
+    int command_tree::add(std::string name, int parent, const options &opts)
+    {
+        int id = add(std::move(name), parent);
+        if (id != -1)
+            this->commands[id].opts = &opts;
+        return id;
+    }
+
+    // Gives a command, such as the root, a registry of its options.
+    //
+    //   * int id              - The id of the command.
+    //   * const options &opts - The registry of the command's options. It must outlive the tree.
+    //
+    //   * return (bool) - True if the command exists, false otherwise.
+    bool command_tree::use_options(int id, const options &opts)
+    {
+        if (!exists(id))
+            return false;
+        this->commands[id].opts = &opts;
+        return true;
+    }
+
+    // Looks up a subcommand by name.
+    //
+    //   * int parent            - The id of the parent command.
+    //   * std::string_view name - The name of the subcommand.
+    //
+    //   * return (int) - The id of the subcommand, or -1 if there is none or no such parent.
+    int command_tree::find(int parent, std::string_view name) const
+    {
+        if (!exists(parent))
+            return -1;
+        return this->commands[parent].children.find(name);
+    }
+
+    // Collects the subcommands whose names start with the given prefix, in name order.
+    // Nothing is collected if there is no such parent.
+    //
+    //   * int parent              - The id of the parent command.
+    //   * std::string_view prefix - The prefix to look up.
+    //   * std::vector<int> &ids   - The vector to append the ids of the subcommands to.
+    void command_tree::complete(int parent, std::string_view prefix, std::vector<int> &ids) const
+    {
+        if (exists(parent))
+            this->commands[parent].children.collect(prefix, ids);
+    }
+
+    // Returns the name of a command.
+    //
+    //   * int id - The id of the command.
+    //
+    //   * return (const std::string &) - The name of the command, or an empty string if there is none.
+    const std::string &command_tree::name(int id) const
+    {
+        static const std::string none;
+        if (!exists(id))
+            return none;
+        return this->commands[id].name;
+    }
+
+    // Returns the parent of a command.
+    //
+    //   * int id - The id of the command.
+    //
+    //   * return (int) - The id of the parent command, or -1 for the root or an unknown id.
+    int command_tree::parent(int id) const
+    {
+        if (!exists(id))
+            return -1;
+        return this->commands[id].parent;
+    }
+
+    // Splits the command line into levels and parses each of them.
+    // A positional argument that names a subcommand of the current level
+    // starts a new level, unless it is the value of an option that the current level's
+    // registry says takes one; everything after "--" stays with the current level.
+    // The arguments are viewed once, and each level borrows its window of the views.
+    //
+    //   * int argc     - The count of command line arguments.
+    //   * char *argv[] - The command line arguments. They must outlive the levels.
+    //
+    //   * return (std::vector<command_level>) - The levels, starting with the root.
+    std::vector<command_level> command_tree::dispatch(int argc, char *argv[]) const
+    {
+        std::vector<std::string_view> views(argv, argv + argc);
+        std::span<const std::string_view> all(views);
+        std::vector<command_level> levels;
+
+        // Builds the level that owns views[start] through views[end - 1].
+        // The first of them is the command name itself, which the level skips.
+        auto level = [&](int id, int start, int end) {
+            int first = std::min(start + 1, end);
+            std::span<const std::string_view> window = all.subspan(first, end - first);
+            const options *opts = this->commands[id].opts;
+            return command_level{id, opts != nullptr ? argh(window, *opts) : argh(window)};
+        };
+
+        int current = root;
+        int start = 0;
+        for (int i = 1; i < argc; i++)
+        {
+            std::string_view token = views[i];
+
+            // Everything after a double dash belongs to the current level.
+            if (token == "--")
+                break;
+
+            // Options are never subcommands, and neither are their values. A lone dash is a positional argument.
+            if (token.length() > 1 && token[0] == '-')
+            {
+                if (takes_value(this->commands[current].opts, token))
+                    i++;
+                continue;
+            }
+
+            int child = find(current, token);
+            if (child == -1)
+                continue;
+
+            levels.push_back(level(current, start, i));
+            current = child;
+            start = i;
+        }
+
+        levels.push_back(level(current, start, argc));
+        return levels;
+    }
+
+    // A helper method to check that a command exists.
+    //
+    //   * int id - The id of the command.
+    //
+    //   * return (bool) - True if the command exists.
+    bool command_tree::exists(int id) const
+    {
+        return id >= 0 && (long unsigned int)id < this->commands.size();
+    }
+}
@@ -0,0 +1,171 @@
+// src/argh/subcommand.h
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the subcommand headers.
+// Use this utility to dispatch command lines like "prg do_a_thing -abc".
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef SUBCOMMAND_H
+#define SUBCOMMAND_H
+
+#include "argh.h"
+#include "options.h"
+#include "trie.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // A single level of a dispatched command line.
+    struct command_level
+    {
+        // The id of the command at this level.
+        int id;
+
+        // The options and positional arguments that belong to this level only.
+        argh args;
+    };
+
+    // The argh::command_tree class holds a tree of registered subcommands.
+    //
+    // Each command resolves its children through its own trie, so dispatching
+    // among hundreds of subcommands costs one walk over the subcommand's name.
+    //
+    // Every level of the command line is parsed by its own argh instance,
+    // which sees only the tokens between its command and the next subcommand,
+    // and resolves them against the command's own registry of options, if it has one.
+    // The registry also tells the walk which options take a value, so that a value
+    // that happens to name a subcommand is not mistaken for one.
+    // The tokens are never copied to be handed down: each level borrows a window
+    // of views into the original argv vector.
+    //
+    //    argh::options remote_options;
+    //    remote_options.add("--verbose");
+    //    argh::options add_options;
+    //    add_options.add("--track", nullptr, "BRANCH");
+    //
+    //    argh::command_tree tree;
+    //    int remote = tree.add("remote", argh::command_tree::root, remote_options);
+    //    int remote_add = tree.add("add", remote, add_options);
+    //
+    //    auto levels = tree.dispatch(argc, argv);
+    //    if (levels.back().id == remote_add && levels.back().args["--track"])
+    //    {
+    //        ...
+    //    }
+    //
+    // The registries must outlive the tree.
+    class command_tree
+    {
+        public:
+        // The id of the root command (the program itself).
+        static constexpr int root = 0;
+
+        // The zero-argument constructor that creates a tree with only the root command.
+        command_tree();
+
+        // Registers a subcommand. Registering a name again under the same parent
+        // returns the id it already has.
+        //
+        //   * std::string name - The name of the subcommand.
+        //   * int parent       - The id of the parent command.
+        //
+        //   * return (int) - The id of the subcommand, or -1 if there is no such parent.
+        int add(std::string name, int parent = root);
+
+        // Registers a subcommand, as above, with a registry of its options.
+        // Registering a name again gives the existing subcommand this registry.
+        //
+        //   * std::string name    - The name of the subcommand.
+        //   * int parent          - The id of the parent command.
+        //   * const options &opts - The registry of the subcommand's options. It must outlive the tree.
+        //
+        //   * return (int) - The id of the subcommand, or -1 if there is no such parent.
+        int add(std::string name, int parent, const options &opts);
+
+        // Gives a command, such as the root, a registry of its options.
+        //
+        //   * int id              - The id of the command.
+        //   * const options &opts - The registry of the command's options. It must outlive the tree.
+        //
+        //   * return (bool) - True if the command exists, false otherwise.
+        bool use_options(int id, const options &opts);
+
+        // Looks up a subcommand by name.
+        //
+        //   * int parent            - The id of the parent command.
+        //   * std::string_view name - The name of the subcommand.
+        //
+        //   * return (int) - The id of the subcommand, or -1 if there is none or no such parent.
+        int find(int parent, std::string_view name) const;
+
+        // Collects the subcommands whose names start with the given prefix, in name order.
+        // Nothing is collected if there is no such parent.
+        //
+        //   * int parent              - The id of the parent command.
+        //   * std::string_view prefix - The prefix to look up.
+        //   * std::vector<int> &ids   - The vector to append the ids of the subcommands to.
+        void complete(int parent, std::string_view prefix, std::vector<int> &ids) const;
+
+        // Returns the name of a command.
+        //
+        //   * int id - The id of the command.
+        //
+        //   * return (const std::string &) - The name of the command, or an empty string if there is none.
+        const std::string &name(int id) const;
+
+        // Returns the parent of a command.
+        //
+        //   * int id - The id of the command.
+        //
+        //   * return (int) - The id of the parent command, or -1 for the root or an unknown id.
+        int parent(int id) const;
+
+        // Splits the command line into levels and parses each of them.
+        // A positional argument that names a subcommand of the current level
+        // starts a new level, unless it is the value of an option that the current level's
+        // registry says takes one; everything after "--" stays with the current level.
+        //
+        //   * int argc     - The count of command line arguments.
+        //   * char *argv[] - The command line arguments. They must outlive the levels.
+        //
+        //   * return (std::vector<command_level>) - The levels, starting with the root.
+        std::vector<command_level> dispatch(int argc, char *argv[]) const;
+
+        private:
+        // A single registered command.
+        struct command
+        {
+            // The name of the command.
+            std::string name;
+
+            // The id of the parent command, or -1 for the root.
+            int parent;
+
+            // The children of the command, keyed by name.
+            trie children;
+
+            // The registry of the command's options, or nullptr.
+            const options *opts;
+        };
+
+        // A helper method to check that a command exists.
+        //
+        //   * int id - The id of the command.
+        //
+        //   * return (bool) - True if the command exists.
+        bool exists(int id) const;
+
+        // The registered commands, indexed by id.
+        std::vector<command> commands;
+    };
+}
+
+#endif
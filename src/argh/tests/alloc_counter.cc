@@ -0,0 +1,176 @@
+// src/argh/tests/alloc_counter.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the alloc_counter class,
+// and the replacements of the global operator new and operator delete.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "alloc_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+// The running totals for the current thread.
+// These are plain integers, so they need no dynamic initialization
+// and are safe to use from the very first allocation of the thread.
+static thread_local long int thread_allocations = 0;
+static thread_local long int thread_deallocations = 0;
+static thread_local long int thread_bytes = 0;
+
+// Counts and performs an allocation.
+//
+//   * std::size_t size       - The number of bytes to allocate.
+//   * std::size_t alignment  - The alignment of the allocation, or 0 for the default.
+//
+//   * return (void *) - The allocated memory, or nullptr on failure.
+static void *counted_allocate(std::size_t size, std::size_t alignment)
+{
+    thread_allocations++;
+    thread_bytes += size;
+
+    if (size == 0)
+        size = 1;
+    if (alignment == 0)
+        return std::malloc(size);
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+// Counts and performs a deallocation.
+//
+//   * void *pointer - The memory to free.
+static void counted_free(void *pointer)
+{
+    if (pointer == nullptr)
+        return;
+    thread_deallocations++;
+    std::free(pointer);
+}
+
+void *operator new(std::size_t size)
+{
+    void *pointer = counted_allocate(size, 0);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](std::size_t size)
+{
+    void *pointer = counted_allocate(size, 0);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    void *pointer = counted_allocate(size, (std::size_t)alignment);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    void *pointer = counted_allocate(size, (std::size_t)alignment);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_allocate(size, 0);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_allocate(size, 0);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+namespace argh
+{
+    // The zero-argument constructor that starts counting.
+    alloc_counter::alloc_counter()
+    {
+        reset();
+    }
+
+    // Starts counting again from zero.
+    void alloc_counter::reset()
+    {
+        this->start_allocations = thread_allocations;
+        this->start_deallocations = thread_deallocations;
+        this->start_bytes = thread_bytes;
+    }
+
+    // Returns the number of calls to operator new since counting started.
+    //
+    //   * return (long int) - The number of allocations.
+    long int alloc_counter::allocations() const
+    {
+        return thread_allocations - this->start_allocations;
+    }
+
+    // Returns the number of calls to operator delete since counting started.
+    // Deleting a null pointer is not counted.
+    //
+    //   * return (long int) - The number of deallocations.
+    long int alloc_counter::deallocations() const
+    {
+        return thread_deallocations - this->start_deallocations;
+    }
+
+    // Returns the number of bytes requested from operator new since counting started.
+    //
+    //   * return (long int) - The number of bytes allocated.
+    long int alloc_counter::bytes() const
+    {
+        return thread_bytes - this->start_bytes;
+    }
+}
@@ -0,0 +1,63 @@
+// src/argh/tests/alloc_counter.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the alloc_counter headers.
+// Linking this library replaces the global operator new and operator delete
+// with versions that count every call, so that tests can hold argh to an allocation budget.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+namespace argh
+{
+    // The argh::alloc_counter class counts the allocations made by the current thread
+    // from the moment it is constructed.
+    //
+    //    argh::alloc_counter counter;
+    //    argh::argh args(argc, argv);
+    //    ASSERT_LE(counter.allocations(), 10);
+    //
+    class alloc_counter
+    {
+        public:
+        // The zero-argument constructor that starts counting.
+        alloc_counter();
+
+        // Starts counting again from zero.
+        void reset();
+
+        // Returns the number of calls to operator new since counting started.
+        //
+        //   * return (long int) - The number of allocations.
+        long int allocations() const;
+
+        // Returns the number of calls to operator delete since counting started.
+        // Deleting a null pointer is not counted.
+        //
+        //   * return (long int) - The number of deallocations.
+        long int deallocations() const;
+
+        // Returns the number of bytes requested from operator new since counting started.
+        //
+        //   * return (long int) - The number of bytes allocated.
+        long int bytes() const;
+
+        private:
+        // The thread's allocation count when counting started.
+        long int start_allocations;
+
+        // The thread's deallocation count when counting started.
+        long int start_deallocations;
+
+        // The thread's allocated byte count when counting started.
+        long int start_bytes;
+    };
+}
+
+#endif
@@ -1,5 +1,5 @@
 // src/argh/tests/argh.test.cc
-// v0.2.1
+// v0.9.0
 //
 // Author: Cayden Lund
 //   Date: 09/26/2021
@@ -12,6 +12,14 @@
 #include <gtest/gtest.h>
 
 #include "argh/argh.h"
+#include "argh/tests/alloc_counter.h"
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
 
 // Test the argh::argh class constructor.
 // This test ensures that the argh::argh class can be instantiated
@@ -238,3 +246,354 @@ TEST(argh_argh_test, argh_argh_positional_complex_test)
     ASSERT_STREQ("input.txt", args_d[1].c_str());
     ASSERT_STREQ("", args_d[2].c_str());
 }
+
+// This test ensures that the argh::argh class resolves unique abbreviations
+// of registered long options, and reports the ambiguous ones.
+TEST(argh_argh_test, argh_argh_abbreviation_test)
+{
+    argh::options opts;
+    opts.add("-v");
+    opts.add("--verbose");
+    opts.add("--version");
+    opts.add("--output");
+    opts.add("--out");
+
+    std::string argv_a[] = {"test", "--verb", "--outp=output.txt", "--ou", "file.txt"};
+    argh::argh args_a(5, argv_a, opts);
+    ASSERT_TRUE(args_a["--verbose"]);
+    ASSERT_FALSE(args_a["--verb"]);
+    ASSERT_FALSE(args_a["-v"]);
+    ASSERT_STREQ("output.txt", args_a("--output").c_str());
+    // "--ou" abbreviates both "--out" and "--output".
+    ASSERT_TRUE(args_a["--ou"]);
+    ASSERT_EQ(1u, args_a.ambiguous_options().size());
+    ASSERT_STREQ("--ou", args_a.ambiguous_options()[0].c_str());
+
+    std::string argv_b[] = {"test", "--ver", "--out", "file.txt", "--unknown"};
+    argh::argh args_b(5, argv_b, opts);
+    ASSERT_TRUE(args_b["--ver"]);
+    ASSERT_FALSE(args_b["--verbose"]);
+    ASSERT_FALSE(args_b["--version"]);
+    // An exact match wins over the longer option.
+    ASSERT_STREQ("file.txt", args_b("--out").c_str());
+    ASSERT_TRUE(args_b["--unknown"]);
+    ASSERT_EQ(1u, args_b.ambiguous_options().size());
+
+    // Without a registry, nothing is abbreviated.
+    std::string argv_c[] = {"test", "--verb"};
+    argh::argh args_c(2, argv_c);
+    ASSERT_TRUE(args_c["--verb"]);
+    ASSERT_FALSE(args_c["--verbose"]);
+    ASSERT_EQ(0u, args_c.ambiguous_options().size());
+}
+
+// Parses the given argv vector and returns the number of allocations it took,
+// including the allocations made to destroy the parser.
+// The option names are interned once per process, so a first parse warms the table up.
+static long int count_parse_allocations(std::vector<std::string> argv)
+{
+    {
+        argh::argh warmup(argv.size(), argv.data());
+    }
+    argh::alloc_counter counter;
+    {
+        argh::argh args(argv.size(), argv.data());
+    }
+    return counter.allocations();
+}
+
+// This test holds the argh::argh class to an allocation budget for representative parses,
+// so that a regression in how arguments are copied or stored fails the build.
+TEST(argh_argh_test, argh_argh_allocation_budget_test)
+{
+    ASSERT_LE(count_parse_allocations({"test", "-abc", "-o", "output.txt", "input.txt"}), 0);
+
+    std::vector<std::string> short_flags = {"test"};
+    for (int i = 0; i < 100; i++)
+        short_flags.push_back(std::string("-") + (char)('a' + i % 26));
+    // The three per-argument arrays, and the 26 flags spilling their list and filling their index.
+    ASSERT_LE(count_parse_allocations(short_flags), 6);
+
+    std::vector<std::string> clusters = {"test"};
+    for (int i = 0; i < 10; i++)
+        clusters.push_back("-abcdefghij");
+    ASSERT_LE(count_parse_allocations(clusters), 0);
+
+    std::vector<std::string> parameters = {"test"};
+    for (int i = 0; i < 100; i++)
+        parameters.push_back("--parameter-" + std::to_string(i) + "=value-" + std::to_string(i));
+    // The per-argument arrays and the text, then the lists and indices of 100 names doubling as they fill.
+    ASSERT_LE(count_parse_allocations(parameters), 19);
+
+    std::vector<std::string> positionals = {"test"};
+    for (int i = 0; i < 100; i++)
+        positionals.push_back("input-" + std::to_string(i) + ".txt");
+    ASSERT_LE(count_parse_allocations(positionals), 4);
+}
+
+// This test ensures that a typical command line, as main receives it, parses
+// and answers its queries without a single heap allocation once the option names are interned.
+TEST(argh_argh_test, argh_argh_zero_allocation_test)
+{
+    char arg0[] = "prg";
+    char arg1[] = "-abc";
+    char arg2[] = "-o";
+    char arg3[] = "out.txt";
+    char arg4[] = "file";
+    char *argv[] = {arg0, arg1, arg2, arg3, arg4};
+    const std::string output = "-o", verbose = "-v";
+    {
+        argh::argh warmup(5, argv);
+    }
+
+    argh::alloc_counter counter;
+    {
+        argh::argh args(5, argv);
+        ASSERT_TRUE(args[output]);
+        ASSERT_FALSE(args[verbose]);
+        ASSERT_EQ("out.txt", args(output));
+        ASSERT_EQ("file", args[0]);
+    }
+    ASSERT_EQ(0, counter.allocations());
+}
+
+// This test ensures that flags and parameters past the inline capacity are still found.
+TEST(argh_argh_test, argh_argh_spill_test)
+{
+    std::vector<std::string> argv = {"test"};
+    for (int i = 0; i < 40; i++)
+        argv.push_back("--flag-" + std::to_string(i));
+    for (int i = 0; i < 20; i++)
+        argv.push_back("--parameter-" + std::to_string(i) + "=value-" + std::to_string(i));
+    argv.push_back("--flag-3");
+    argv.push_back("--parameter-7=last");
+    argh::argh args(argv.size(), argv.data());
+
+    for (int i = 0; i < 40; i++)
+        ASSERT_TRUE(args["--flag-" + std::to_string(i)]);
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_TRUE(args["--parameter-" + std::to_string(i)]);
+        if (i != 7)
+        {
+            ASSERT_EQ("value-" + std::to_string(i), args("--parameter-" + std::to_string(i)));
+        }
+    }
+    ASSERT_EQ("last", args("--parameter-7"));
+    ASSERT_FALSE(args["--flag-40"]);
+
+    argh::argh copy = args;
+    ASSERT_TRUE(copy["--flag-39"]);
+    ASSERT_EQ("value-19", copy("--parameter-19"));
+    ASSERT_EQ("test", copy[0]);
+}
+
+// This test ensures that marking a parameter that owns a great many values
+// takes a single pass, rather than recursing once per value.
+TEST(argh_argh_test, argh_argh_mark_param_many_test)
+{
+    std::vector<std::string> argv = {"test", "input.txt"};
+    for (int i = 0; i < 200000; i++)
+    {
+        argv.push_back("-o");
+        argv.push_back("output.txt");
+    }
+    argv.push_back("last.txt");
+    argh::argh args(argv.size(), argv.data());
+    ASSERT_EQ(200003, args.size());
+
+    args.mark_parameter("-o");
+    ASSERT_EQ(3, args.size());
+    ASSERT_STREQ("input.txt", args[1].c_str());
+    ASSERT_STREQ("last.txt", args[2].c_str());
+}
+
+// Test the argh::argh constructor that takes ownership of a vector of strings.
+// This test ensures that the arguments are parsed in place, and that copies can still use them.
+TEST(argh_argh_test, argh_argh_owned_vector_test)
+{
+    std::vector<std::string> argv = {"test", "-abc", "--output=out.txt", "input-file-with-a-long-name.txt"};
+    argh::argh args(std::move(argv));
+
+    ASSERT_EQ("test", args[0]);
+    ASSERT_TRUE(args["-a"]);
+    ASSERT_TRUE(args["-c"]);
+    ASSERT_EQ("out.txt", args("--output"));
+    ASSERT_EQ("input-file-with-a-long-name.txt", args[1]);
+
+    argh::argh copy = args;
+    ASSERT_EQ("input-file-with-a-long-name.txt", copy[1]);
+    ASSERT_EQ("out.txt", copy("--output"));
+}
+
+// Test the argh::argh constructor that borrows a span of views.
+// This test ensures that the arguments are parsed without being copied.
+TEST(argh_argh_test, argh_argh_span_test)
+{
+    std::string_view argv[] = {"test", "-o", "output.txt", "input.txt"};
+    argh::argh args(argv);
+
+    ASSERT_EQ(3, args.size());
+    ASSERT_EQ("output.txt", args[1]);
+
+    ASSERT_EQ("output.txt", args("-o"));
+    ASSERT_EQ(2, args.size());
+    ASSERT_EQ("test", args[0]);
+    ASSERT_EQ("input.txt", args[1]);
+}
+
+// Test the argh::argh copy and move operations.
+// This test ensures that an instance that stores its own copy of the arguments
+// does not keep any view into the instance it was copied or moved from.
+TEST(argh_argh_test, argh_argh_copy_move_test)
+{
+    std::string argv[] = {"test", "-o", "output.txt", "--level=3", "input.txt"};
+    argh::argh *original = new argh::argh(5, argv);
+    argh::argh copy = *original;
+    argh::argh moved = std::move(*original);
+    delete original;
+
+    for (argh::argh *args : {&copy, &moved})
+    {
+        ASSERT_EQ("output.txt", (*args)("-o"));
+        ASSERT_EQ("3", (*args)("--level"));
+        ASSERT_EQ("test", (*args)[0]);
+        ASSERT_EQ("input.txt", (*args)[1]);
+    }
+
+    std::string other_argv[] = {"other", "-v"};
+    argh::argh assigned(2, other_argv);
+    assigned = copy;
+    ASSERT_FALSE(assigned["-v"]);
+    ASSERT_EQ("output.txt", assigned("-o"));
+    assigned = std::move(moved);
+    ASSERT_EQ("3", assigned("--level"));
+}
+
+// Test the argh::argh class with option names too long for the shared table.
+// This test ensures that such names are kept by the instance, and that its copies still find them.
+TEST(argh_argh_test, argh_argh_local_names_test)
+{
+    std::string flag = "--" + std::string(argh::intern_max_length, 'f');
+    std::string param = "--" + std::string(argh::intern_max_length, 'p');
+    std::string argv[] = {"test", flag, param + "=3", "-o", "output.txt"};
+    argh::argh *original = new argh::argh(5, argv);
+    argh::argh copy = *original;
+    delete original;
+
+    ASSERT_EQ(argh::no_name, argh::find_interned(flag));
+    ASSERT_TRUE(copy[flag]);
+    ASSERT_FALSE(copy[flag + "x"]);
+    ASSERT_EQ("3", copy(param));
+    ASSERT_EQ("output.txt", copy("-o"));
+    std::vector<std::string_view> flags(copy.flags().begin(), copy.flags().end());
+    ASSERT_EQ((std::vector<std::string_view>{flag, param, "-o"}), flags);
+    ASSERT_EQ(param, copy.parameters()[0].name);
+}
+
+// Test the argh::positionals, argh::flags, argh::parameters and argh::raw methods.
+// This test ensures that the views list what was parsed, and that they work with the std::ranges algorithms.
+TEST(argh_argh_test, argh_argh_views_test)
+{
+    static_assert(std::ranges::random_access_range<argh::argh::positional_range>);
+    static_assert(std::ranges::random_access_range<argh::argh::flag_range>);
+    static_assert(std::ranges::random_access_range<argh::argh::parameter_range>);
+    static_assert(std::ranges::view<argh::argh::positional_range>);
+    static_assert(std::random_access_iterator<argh::argh::flag_range::iterator>);
+
+    // The elements are references into the instance, so the iterators meet the Cpp17 requirements
+    // that the classic and parallel algorithms rely on.
+    static_assert(std::is_same_v<std::random_access_iterator_tag,
+                                 std::iterator_traits<argh::argh::positional_range::iterator>::iterator_category>);
+    static_assert(std::is_same_v<std::random_access_iterator_tag,
+                                 std::iterator_traits<argh::argh::flag_range::iterator>::iterator_category>);
+    static_assert(std::is_same_v<std::random_access_iterator_tag,
+                                 std::iterator_traits<argh::argh::parameter_range::iterator>::iterator_category>);
+    static_assert(std::is_same_v<const argh::parameter_entry &,
+                                 std::iterator_traits<argh::argh::parameter_range::iterator>::reference>);
+
+    std::string argv[] = {"test", "-ab", "--level=3", "-o", "output.txt", "input.txt", "-a"};
+    argh::argh args(7, argv);
+
+    ASSERT_EQ(7, args.raw().size());
+    ASSERT_EQ("--level=3", args.raw()[2]);
+
+    std::vector<std::string_view> flags(args.flags().begin(), args.flags().end());
+    ASSERT_EQ((std::vector<std::string_view>{"-a", "-b", "--level", "-o"}), flags);
+    ASSERT_TRUE(std::ranges::find(args.flags(), "-o") != args.flags().end());
+    ASSERT_EQ(args.flags().end(), std::ranges::find(args.flags(), "-v"));
+
+    ASSERT_EQ(2, args.parameters().size());
+    auto [name, value] = args.parameters()[0];
+    ASSERT_EQ("--level", name);
+    ASSERT_EQ("3", value);
+    ASSERT_EQ("output.txt", args.parameters()[1].value);
+    ASSERT_EQ(&args.parameters()[1], &*std::max_element(args.parameters().begin(), args.parameters().end(),
+                                                        [](const auto &a, const auto &b) { return a.name < b.name; }));
+
+    ASSERT_EQ(3, std::ranges::distance(args.positionals()));
+    ASSERT_EQ("output.txt", args.positionals()[1]);
+    ASSERT_EQ(&args.raw()[4], &args.positionals()[1]);
+    std::vector<std::string_view> reversed(std::make_reverse_iterator(args.flags().end()),
+                                           std::make_reverse_iterator(args.flags().begin()));
+    ASSERT_EQ((std::vector<std::string_view>{"-o", "--level", "-b", "-a"}), reversed);
+    ASSERT_EQ(1, std::ranges::count_if(args.positionals(), [](std::string_view arg) { return arg.ends_with(".txt") && arg.starts_with("in"); }));
+
+    args.mark_parameter("-o");
+    std::vector<std::string_view> positionals;
+    std::ranges::copy(args.positionals() | std::views::reverse, std::back_inserter(positionals));
+    ASSERT_EQ((std::vector<std::string_view>{"input.txt", "test"}), positionals);
+}
+
+// This test ensures that listing the flags and positional arguments does not allocate.
+TEST(argh_argh_test, argh_argh_views_allocation_test)
+{
+    std::string argv[] = {"test", "-v", "--level=3", "input.txt"};
+    argh::argh args(4, argv);
+
+    argh::alloc_counter counter;
+    std::size_t length = 0;
+    for (std::string_view flag : args.flags())
+        length += flag.length();
+    for (std::string_view positional : args.positionals())
+        length += positional.length();
+    for (auto [name, value] : args.parameters())
+        length += name.length() + value.length();
+    ASSERT_EQ(0, counter.allocations());
+    ASSERT_EQ(2 + 7 + 4 + 9 + 7 + 1, length);
+}
+
+// Test the argh::argh class with validation turned on.
+// This test ensures that invalid arguments are rejected by their index in argv, and that the rest are parsed.
+TEST(argh_argh_test, argh_argh_validation_test)
+{
+    argh::options opts;
+    opts.validate_text();
+
+    char arg0[] = "prg";
+    char arg1[] = "--name=caf\xc3\xa9";
+    char arg2[] = "--bad=\xc3\x28";
+    char arg3[] = "\x1b[2Jinput.txt";
+    char arg4[] = "-v";
+    char *argv[] = {arg0, arg1, arg2, arg3, arg4};
+    argh::argh args(5, argv, opts);
+
+    ASSERT_EQ("caf\xc3\xa9", args("--name"));
+    ASSERT_FALSE(args["--bad"]);
+    ASSERT_TRUE(args["-v"]);
+    ASSERT_EQ(0, args.size());
+
+    std::vector<argh::rejected_argument> rejected = args.rejected_arguments();
+    ASSERT_EQ(2, rejected.size());
+    ASSERT_EQ(2, rejected[0].index);
+    ASSERT_EQ(argh::text_problem::invalid_utf8, rejected[0].problem);
+    ASSERT_EQ(3, rejected[1].index);
+    ASSERT_EQ(argh::text_problem::control_character, rejected[1].problem);
+
+    std::string strings[] = {"\xff", "ok"};
+    argh::argh unchecked(2, strings);
+    ASSERT_EQ(2, unchecked.size());
+    ASSERT_TRUE(unchecked.rejected_arguments().empty());
+    argh::argh checked(2, strings, opts);
+    ASSERT_EQ(0, checked.rejected_arguments()[0].index);
+}
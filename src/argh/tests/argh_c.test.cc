@@ -0,0 +1,90 @@
+// src/argh/tests/argh_c.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for the argh C API.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/argh_c.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Defined in argh_c_caller.c.
+extern "C" int argh_c_caller(void);
+
+// Test the argh C API from C.
+// This test ensures that the header compiles as C, and that the functions link with C linkage.
+TEST(argh_c_test, argh_c_caller_test)
+{
+    ASSERT_EQ(0, argh_c_caller());
+}
+
+// Test the argh_has_flag function.
+// This test ensures that flags are found, and that the program name is skipped.
+TEST(argh_c_test, argh_c_flag_test)
+{
+    const char *argv[] = {"-prg", "-ab", "--verbose"};
+    argh_parser *args = argh_parse(3, argv);
+    ASSERT_NE(nullptr, args);
+
+    ASSERT_EQ(1, argh_has_flag(args, "-a"));
+    ASSERT_EQ(1, argh_has_flag(args, "-b"));
+    ASSERT_EQ(1, argh_has_flag(args, "--verbose"));
+    ASSERT_EQ(0, argh_has_flag(args, "-p"));
+    ASSERT_EQ(0, argh_has_flag(args, "--never-given"));
+    argh_free(args);
+}
+
+// Test the argh_get_param and argh_positional functions.
+// This test ensures that the results point into argv rather than into copies.
+TEST(argh_c_test, argh_c_borrow_test)
+{
+    const char *argv[] = {"prg", "-o", "output.txt", "--level=3", "--empty=", "input.txt"};
+    argh_parser *args = argh_parse(6, argv);
+    ASSERT_EQ(2, argh_positional_count(args));
+
+    std::size_t length = 0;
+    ASSERT_EQ(argv[2], argh_get_param(args, "-o", &length));
+    ASSERT_EQ(10, length);
+    ASSERT_EQ(argv[3] + 8, argh_get_param(args, "--level", &length));
+    ASSERT_EQ(1, length);
+    ASSERT_EQ(argv[4] + 8, argh_get_param(args, "--empty", &length));
+    ASSERT_EQ(0, length);
+    ASSERT_EQ(nullptr, argh_get_param(args, "--missing", &length));
+    ASSERT_EQ(0, length);
+
+    ASSERT_EQ(1, argh_positional_count(args));
+    ASSERT_EQ(argv[5], argh_positional(args, 0, &length));
+    ASSERT_EQ(9, length);
+    ASSERT_EQ(nullptr, argh_positional(args, 1, nullptr));
+    ASSERT_EQ(nullptr, argh_positional(args, -1, nullptr));
+    argh_free(args);
+}
+
+// Test the argh_parse function with a long command line.
+// This test ensures that argv may be larger than the inline storage.
+TEST(argh_c_test, argh_c_long_test)
+{
+    std::string storage[100];
+    const char *argv[100];
+    for (int i = 0; i < 100; i++)
+    {
+        storage[i] = "--flag-" + std::to_string(i);
+        argv[i] = storage[i].c_str();
+    }
+
+    argh_parser *args = argh_parse(100, argv);
+    for (int i = 1; i < 100; i++)
+        ASSERT_EQ(1, argh_has_flag(args, argv[i]));
+    ASSERT_EQ(0, argh_has_flag(args, argv[0]));
+    argh_free(args);
+    argh_free(nullptr);
+}
@@ -0,0 +1,39 @@
+// src/argh/tests/argh_c_caller.c
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file calls the argh C API from C, so that the tests catch
+// anything in the header that only compiles as C++.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "argh/argh_c.h"
+
+#include <string.h>
+
+// Parses a small command line and checks every query.
+//
+//   * return (int) - 0 if every query returned what it should, or the number of the first that didn't.
+int argh_c_caller(void)
+{
+    const char *argv[] = {"prg", "-v", "--output=out.txt", "input.txt"};
+    argh_parser *args = argh_parse(4, argv);
+    if (args == NULL)
+        return 1;
+
+    int result = 0;
+    size_t length = 0;
+    const char *output = argh_get_param(args, "--output", &length);
+    if (!argh_has_flag(args, "-v"))
+        result = 2;
+    else if (output == NULL || length != 7 || strcmp(output, "out.txt") != 0)
+        result = 3;
+    else if (argh_positional_count(args) != 1 || argh_positional(args, 0, NULL) != argv[3])
+        result = 4;
+
+    argh_free(args);
+    return result;
+}
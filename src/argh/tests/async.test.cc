@@ -0,0 +1,108 @@
+// src/argh/tests/async.test.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for argh asynchronous parsing.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/async.h"
+#include "argh/options.h"
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test the argh::parse_async function.
+// This test ensures that the handle answers queries as the argh class does.
+TEST(argh_async_test, argh_async_argv_test)
+{
+    char arg0[] = "prg";
+    char arg1[] = "-v";
+    char arg2[] = "--verb";
+    char arg3[] = "--output=out.txt";
+    char arg4[] = "input.txt";
+    char *argv[] = {arg0, arg1, arg2, arg3, arg4};
+
+    argh::options opts;
+    opts.add("--verbose");
+    argh::pending_argh args = argh::parse_async(5, argv, opts);
+    args.wait();
+    ASSERT_TRUE(args.ready());
+    ASSERT_TRUE(args.has_flag("-v"));
+    ASSERT_TRUE(args.has_flag("--verbose"));
+    ASSERT_EQ("out.txt", args.parameter_value("--output"));
+    ASSERT_EQ(1, args.size());
+    ASSERT_EQ("input.txt", args.positional(0));
+}
+
+// Test the argh::parse_async function with response files.
+// This test ensures that "@file" arguments are expanded, including nested ones, only when
+// the registry asks for it, and that arguments naming missing files or directories are kept.
+TEST(argh_async_test, argh_async_response_file_test)
+{
+    std::string outer = testing::TempDir() + "argh_async_outer.rsp";
+    std::string inner = testing::TempDir() + "argh_async_inner.rsp";
+    std::ofstream(outer) << "--level 3 'file one.txt'\n@" << inner << "\n";
+    std::ofstream(inner) << "--name=\"a b\" -q\n";
+
+    argh::options opts;
+    opts.read_response_files();
+    argh::pending_argh args =
+        argh::parse_async({"-v", "@" + outer, "@missing.rsp", "@" + testing::TempDir(), "last"}, opts);
+    ASSERT_TRUE(args.has_flag("-v"));
+    ASSERT_TRUE(args.has_flag("-q"));
+    ASSERT_EQ("a b", args.parameter_value("--name"));
+    ASSERT_EQ("3", args.parameter_value("--level"));
+    ASSERT_EQ(4, args.size());
+    ASSERT_EQ("file one.txt", args.positional(0));
+    ASSERT_EQ("@missing.rsp", args.positional(1));
+    ASSERT_EQ("@" + testing::TempDir(), args.positional(2));
+    ASSERT_EQ("last", args.positional(3));
+
+    // By default, as with the argh constructors, nothing is read.
+    argh::pending_argh literal = argh::parse_async({"-v", "@" + outer});
+    ASSERT_FALSE(literal.has_flag("-q"));
+    ASSERT_EQ(1, literal.size());
+    ASSERT_EQ("@" + outer, literal.positional(0));
+
+    std::remove(outer.c_str());
+    std::remove(inner.c_str());
+}
+
+// Test the argh::parse_async callback.
+// This test ensures that the callback runs on the parsing thread before the handle is ready,
+// that queries wait for it, and that exceptions reach the queries.
+TEST(argh_async_test, argh_async_callback_test)
+{
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::thread::id caller = std::this_thread::get_id();
+    std::thread::id parser;
+
+    argh::pending_argh args = argh::parse_async({"--output", "out.txt", "input.txt"}, [&](argh::argh &parsed) {
+        parser = std::this_thread::get_id();
+        released.wait();
+        parsed.mark_parameter("--output");
+    });
+    ASSERT_FALSE(args.ready());
+    release.set_value();
+
+    // The query waits for the callback, which has removed the parameter's value.
+    ASSERT_EQ(1, args.size());
+    ASSERT_TRUE(args.ready());
+    ASSERT_NE(caller, parser);
+    ASSERT_EQ("input.txt", args.positional(0));
+
+    argh::pending_argh failed = argh::parse_async({"-v"}, [](argh::argh &) { throw std::runtime_error("bad"); });
+    ASSERT_THROW(failed.has_flag("-v"), std::runtime_error);
+}
@@ -0,0 +1,171 @@
+// src/argh/tests/completion.test.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh completion utility.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/completion.h"
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Test the argh::completer class for a program without subcommands.
+// This test ensures that options are completed by prefix, in name order.
+TEST(argh_completion_test, argh_completion_options_test)
+{
+    argh::options opts;
+    opts.add("--version");
+    opts.add("--verbose");
+    opts.add("--output");
+    opts.add("-v");
+
+    argh::completer engine(opts);
+
+    std::vector<std::string_view> candidates;
+    engine.complete({"prg", "--ver"}, candidates);
+    ASSERT_EQ(2u, candidates.size());
+    ASSERT_EQ("--verbose", candidates[0]);
+    ASSERT_EQ("--version", candidates[1]);
+
+    candidates.clear();
+    engine.complete({"prg", "-"}, candidates);
+    ASSERT_EQ(4u, candidates.size());
+
+    candidates.clear();
+    engine.complete({"prg", "--x"}, candidates);
+    ASSERT_EQ(0u, candidates.size());
+
+    // Words that don't start with a dash have nothing to complete without subcommands.
+    candidates.clear();
+    engine.complete({"prg", ""}, candidates);
+    ASSERT_EQ(0u, candidates.size());
+}
+
+// Test the argh::completer class for a program with subcommands.
+// This test ensures that each command completes its own subcommands and options.
+TEST(argh_completion_test, argh_completion_subcommand_test)
+{
+    argh::command_tree tree;
+    int remote = tree.add("remote");
+    tree.add("add", remote);
+    tree.add("remove", remote);
+    tree.add("rebase");
+
+    argh::options root_opts;
+    root_opts.add("--version");
+    argh::options remote_opts;
+    remote_opts.add("--verbose");
+
+    argh::completer engine(tree);
+    engine.add_options(root_opts);
+    engine.add_options(remote_opts, remote);
+
+    std::vector<std::string_view> candidates;
+    engine.complete({"prg", "re"}, candidates);
+    ASSERT_EQ(2u, candidates.size());
+    ASSERT_EQ("rebase", candidates[0]);
+    ASSERT_EQ("remote", candidates[1]);
+
+    candidates.clear();
+    engine.complete({"prg", "-v", "remote", ""}, candidates);
+    ASSERT_EQ(2u, candidates.size());
+    ASSERT_EQ("add", candidates[0]);
+    ASSERT_EQ("remove", candidates[1]);
+
+    candidates.clear();
+    engine.complete({"prg", "remote", "--ver"}, candidates);
+    ASSERT_EQ(1u, candidates.size());
+    ASSERT_EQ("--verbose", candidates[0]);
+
+    candidates.clear();
+    engine.complete({"prg", "--ver"}, candidates);
+    ASSERT_EQ(1u, candidates.size());
+    ASSERT_EQ("--version", candidates[0]);
+
+    candidates.clear();
+    engine.complete({"prg", "remote", "--", "a"}, candidates);
+    ASSERT_EQ(0u, candidates.size());
+}
+
+// Test the argh::completion_server class.
+// This test ensures that requests sent over the socket get the completer's answers.
+TEST(argh_completion_test, argh_completion_server_test)
+{
+    argh::options opts;
+    opts.add("--verbose");
+    opts.add("--version");
+    argh::completer engine(opts);
+
+    std::string path = "/tmp/argh_completion_test." + std::to_string(getpid()) + ".sock";
+    argh::completion_server server(engine, path);
+    ASSERT_TRUE(server.listen());
+    std::thread serving([&server]() { server.serve(); });
+
+    std::string response;
+    ASSERT_TRUE(argh::query_completion_server(path, "prg\t--ver", response));
+    ASSERT_STREQ("--verbose\n--version\n", response.c_str());
+
+    ASSERT_TRUE(argh::query_completion_server(path, "prg\t--verb", response));
+    ASSERT_STREQ("--verbose\n", response.c_str());
+
+    ASSERT_TRUE(argh::query_completion_server(path, "prg\tfile", response));
+    ASSERT_STREQ("", response.c_str());
+
+    server.stop();
+    serving.join();
+}
+
+// Test the argh::completion_server class with misbehaving clients and paths.
+// This test ensures that a silent client is dropped, that serve can be called again
+// after stop, and that a file that is not a socket is never removed.
+TEST(argh_completion_test, argh_completion_server_robustness_test)
+{
+    argh::options opts;
+    opts.add("--verbose");
+    argh::completer engine(opts);
+
+    std::string file = "/tmp/argh_completion_test." + std::to_string(getpid()) + ".txt";
+    std::ofstream(file) << "keep\n";
+    argh::completion_server refused(engine, file);
+    ASSERT_FALSE(refused.listen());
+    ASSERT_EQ(0, access(file.c_str(), F_OK));
+    unlink(file.c_str());
+
+    std::string path = "/tmp/argh_completion_test." + std::to_string(getpid()) + ".sock";
+    argh::completion_server server(engine, path);
+    ASSERT_TRUE(server.listen());
+
+    // A client that connects and never sends its request.
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, sizeof(address.sun_path) - 1);
+    int silent = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(0, connect(silent, (sockaddr *)&address, sizeof(address)));
+
+    for (int round = 0; round < 2; round++)
+    {
+        bool stopped = false;
+        std::thread serving([&server, &stopped]() { stopped = server.serve(); });
+        std::string response;
+        ASSERT_TRUE(argh::query_completion_server(path, "prg\t--verb", response));
+        ASSERT_STREQ("--verbose\n", response.c_str());
+        server.stop();
+        serving.join();
+        ASSERT_TRUE(stopped);
+    }
+    close(silent);
+}
@@ -0,0 +1,79 @@
+// src/argh/tests/flat_table.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh flat_table class.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/flat_table.h"
+
+#include <cstdint>
+#include <utility>
+
+// Test the argh::flat_table class.
+// This test ensures that keys are found, and that a present key keeps its first value.
+TEST(argh_flat_table_test, argh_flat_table_simple_test)
+{
+    argh::flat_table table;
+    ASSERT_TRUE(table.empty());
+    ASSERT_EQ(0u, table.capacity());
+    ASSERT_EQ(nullptr, table.find(1));
+
+    ASSERT_TRUE(table.try_emplace(1, 10).second);
+    ASSERT_TRUE(table.try_emplace(2, 20).second);
+    auto [value, inserted] = table.try_emplace(1, 30);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(10u, *value);
+
+    *value = 40;
+    ASSERT_EQ(40u, *table.find(1));
+    ASSERT_EQ(20u, *table.find(2));
+    ASSERT_EQ(nullptr, table.find(3));
+    ASSERT_EQ(2u, table.size());
+}
+
+// Test the argh::flat_table class with many keys.
+// This test ensures that every key survives the table growing, including keys that collide.
+TEST(argh_flat_table_test, argh_flat_table_growth_test)
+{
+    argh::flat_table table;
+    for (std::uint32_t i = 0; i < 100000; i++)
+        ASSERT_TRUE(table.try_emplace(i * 4096, i).second);
+
+    ASSERT_EQ(100000u, table.size());
+    ASSERT_LE(table.size() * 8, table.capacity() * 7);
+    for (std::uint32_t i = 0; i < 100000; i++)
+        ASSERT_EQ(i, *table.find(i * 4096));
+    ASSERT_EQ(nullptr, table.find(1));
+}
+
+// Test the argh::flat_table class copy and move operations.
+TEST(argh_flat_table_test, argh_flat_table_copy_move_test)
+{
+    argh::flat_table table;
+    for (std::uint32_t i = 0; i < 100; i++)
+        table.try_emplace(i, i * 2);
+
+    argh::flat_table copy = table;
+    copy.try_emplace(1000, 1);
+    ASSERT_EQ(100u, table.size());
+    ASSERT_EQ(101u, copy.size());
+    ASSERT_EQ(nullptr, table.find(1000));
+    ASSERT_EQ(198u, *copy.find(99));
+
+    argh::flat_table moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(1u, *moved.find(1000));
+
+    moved = table;
+    ASSERT_EQ(nullptr, moved.find(1000));
+    moved.clear();
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ(nullptr, moved.find(0));
+}
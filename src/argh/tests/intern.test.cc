@@ -0,0 +1,119 @@
+// src/argh/tests/intern.test.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh option name interning table.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/intern.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test the argh::intern function.
+// This test ensures that a name keeps its id, and that distinct names get distinct ids.
+TEST(argh_intern_test, argh_intern_simple_test)
+{
+    std::uint32_t output = argh::intern("--output");
+    std::uint32_t verbose = argh::intern("-v");
+    ASSERT_NE(argh::no_name, output);
+    ASSERT_NE(argh::no_name, verbose);
+    ASSERT_NE(output, verbose);
+
+    ASSERT_EQ(output, argh::intern(std::string("--output")));
+    ASSERT_EQ(output, argh::find_interned("--output"));
+    ASSERT_EQ("--output", argh::interned_name(output));
+    ASSERT_EQ("-v", argh::interned_name(verbose));
+}
+
+// Test the argh::find_interned function.
+// This test ensures that looking a name up does not intern it.
+TEST(argh_intern_test, argh_intern_find_test)
+{
+    ASSERT_EQ(argh::no_name, argh::find_interned("--never-interned"));
+    ASSERT_EQ(argh::no_name, argh::find_interned("--never-interned"));
+    ASSERT_EQ("", argh::interned_name(argh::no_name));
+}
+
+// Test the argh::intern function with many names.
+// This test ensures that ids survive the table growing.
+TEST(argh_intern_test, argh_intern_growth_test)
+{
+    std::vector<std::uint32_t> ids;
+    for (int i = 0; i < 5000; i++)
+        ids.push_back(argh::intern("--growth-" + std::to_string(i)));
+
+    for (int i = 0; i < 5000; i++)
+    {
+        std::string name = "--growth-" + std::to_string(i);
+        ASSERT_EQ(ids[i], argh::find_interned(name));
+        ASSERT_EQ(name, argh::interned_name(ids[i]));
+    }
+}
+
+// Test the argh::intern function from several threads at once.
+// This test ensures that every thread sees the same id for the same name.
+TEST(argh_intern_test, argh_intern_threads_test)
+{
+    const int thread_count = 8, name_count = 2000;
+    std::vector<std::vector<std::uint32_t>> ids(thread_count, std::vector<std::uint32_t>(name_count));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([t, &ids]() {
+            for (int i = 0; i < name_count; i++)
+            {
+                // Each thread starts at a different name.
+                int n = (i + t * name_count / thread_count) % name_count;
+                ids[t][n] = argh::intern("--thread-" + std::to_string(n));
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (int i = 0; i < name_count; i++)
+    {
+        ASSERT_EQ("--thread-" + std::to_string(i), argh::interned_name(ids[0][i]));
+        for (int t = 1; t < thread_count; t++)
+            ASSERT_EQ(ids[0][i], ids[t][i]);
+    }
+}
+
+// Test the argh::intern function past its limits.
+// This test ensures that long names are refused, and that the table stops growing once it is full.
+TEST(argh_intern_test, argh_intern_capacity_test)
+{
+    ASSERT_NE(argh::no_name, argh::intern(std::string(argh::intern_max_length, 'x')));
+    ASSERT_EQ(argh::no_name, argh::intern(std::string(argh::intern_max_length + 1, 'x')));
+
+    std::uint32_t last = argh::no_name;
+    for (std::uint32_t i = 0; i <= argh::intern_capacity; i++)
+    {
+        std::uint32_t id = argh::intern("--capacity-" + std::to_string(i));
+        if (id == argh::no_name)
+            break;
+        last = id;
+    }
+    ASSERT_EQ(argh::intern_capacity, last);
+    ASSERT_EQ(argh::no_name, argh::intern("--one-too-many"));
+    ASSERT_EQ(argh::intern("--output"), argh::find_interned("--output"));
+
+    argh::local_names locals;
+    std::uint32_t id = locals.add("--one-too-many");
+    ASSERT_NE(argh::no_name, id);
+    ASSERT_EQ(id, locals.add("--one-too-many"));
+    ASSERT_EQ(id, locals.find("--one-too-many"));
+    ASSERT_EQ(argh::no_name, locals.find("--never-added"));
+    ASSERT_EQ("--one-too-many", argh::interned_name(id, &locals));
+    ASSERT_EQ("", argh::interned_name(id, nullptr));
+}
@@ -0,0 +1,91 @@
+// src/argh/tests/memory_usage.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the memory_usage library.
+// Use this library to measure how much memory a process shares with its parent after fork,
+// from the kernel's accounting in /proc/self/smaps.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "memory_usage.h"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace argh
+{
+    namespace
+    {
+        // Adds a line of smaps to a measurement, if it is one of the fields we keep.
+        //
+        //   * const char *line    - The line.
+        //   * memory_usage &usage - The measurement.
+        void add_field(const char *line, memory_usage &usage)
+        {
+            long int kb = 0;
+            if (std::sscanf(line, "Rss: %ld kB", &kb) == 1)
+                usage.rss_kb += kb;
+            else if (std::sscanf(line, "Shared_Clean: %ld kB", &kb) == 1 ||
+                     std::sscanf(line, "Shared_Dirty: %ld kB", &kb) == 1)
+                usage.shared_kb += kb;
+            else if (std::sscanf(line, "Private_Dirty: %ld kB", &kb) == 1)
+                usage.private_dirty_kb += kb;
+            else if (std::sscanf(line, "Anonymous: %ld kB", &kb) == 1)
+                usage.anonymous_kb += kb;
+        }
+    }
+
+    // Measures the mapping that holds an address.
+    // Each mapping in smaps starts with a line giving its address range, followed by its fields.
+    //
+    //   * const void *address - An address in the mapping.
+    //
+    //   * return (memory_usage) - The memory use of the mapping. All zero if no mapping holds the address.
+    memory_usage measure_mapping(const void *address)
+    {
+        memory_usage usage;
+        std::FILE *smaps = std::fopen("/proc/self/smaps", "r");
+        if (smaps == nullptr)
+            return usage;
+
+        std::uintptr_t target = (std::uintptr_t)address;
+        bool inside = false;
+        char line[512];
+        while (std::fgets(line, sizeof(line), smaps) != nullptr)
+        {
+            std::uintptr_t begin, end;
+            if (std::sscanf(line, "%lx-%lx ", &begin, &end) == 2)
+            {
+                if (inside)
+                    break;
+                inside = target >= begin && target < end;
+                continue;
+            }
+            if (inside)
+                add_field(line, usage);
+        }
+        std::fclose(smaps);
+        return usage;
+    }
+
+    // Measures the whole process.
+    //
+    //   * return (memory_usage) - The memory use of the process.
+    memory_usage measure_process()
+    {
+        memory_usage usage;
+        std::FILE *rollup = std::fopen("/proc/self/smaps_rollup", "r");
+        if (rollup == nullptr)
+            return usage;
+
+        char line[512];
+        while (std::fgets(line, sizeof(line), rollup) != nullptr)
+            add_field(line, usage);
+        std::fclose(rollup);
+        return usage;
+    }
+}
@@ -0,0 +1,50 @@
+// src/argh/tests/memory_usage.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the memory_usage headers.
+// Use this library to measure how much memory a process shares with its parent after fork,
+// from the kernel's accounting in /proc/self/smaps.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+namespace argh
+{
+    // The memory use of a mapping, or of the whole process, in kilobytes.
+    // Pages that a forked process has written to since fork are private and dirty;
+    // pages it still shares with its parent are not.
+    struct memory_usage
+    {
+        // The resident pages.
+        long int rss_kb = 0;
+
+        // The resident pages that another process also maps.
+        long int shared_kb = 0;
+
+        // The pages that only this process maps, and that were written to.
+        long int private_dirty_kb = 0;
+
+        // The anonymous pages: the ones that copy-on-write has duplicated, among others.
+        long int anonymous_kb = 0;
+    };
+
+    // Measures the mapping that holds an address.
+    //
+    //   * const void *address - An address in the mapping.
+    //
+    //   * return (memory_usage) - The memory use of the mapping. All zero if no mapping holds the address.
+    memory_usage measure_mapping(const void *address);
+
+    // Measures the whole process.
+    //
+    //   * return (memory_usage) - The memory use of the process.
+    memory_usage measure_process();
+}
+
+#endif
@@ -0,0 +1,139 @@
+// src/argh/tests/proc.test.cc
+// v0.1.1
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for the argh process table scanner.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/options.h"
+#include "argh/proc.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+// A directory laid out like /proc, removed when the test ends.
+class fake_proc
+{
+    public:
+    fake_proc()
+    {
+        char path[] = "/tmp/argh_proc_XXXXXX";
+        this->root = mkdtemp(path);
+    }
+
+    ~fake_proc()
+    {
+        std::filesystem::remove_all(this->root);
+    }
+
+    // Adds a process.
+    //
+    //   * const std::string &name    - The name of the process's directory.
+    //   * const std::string &cmdline - The contents of its cmdline file.
+    void add(const std::string &name, const std::string &cmdline)
+    {
+        std::filesystem::create_directory(this->root + "/" + name);
+        std::ofstream(this->root + "/" + name + "/cmdline", std::ios::binary) << cmdline;
+    }
+
+    std::string root;
+};
+
+// Test the argh::process_scanner class.
+// This test ensures that the options of the schema are found in each command line.
+TEST(argh_proc_test, argh_proc_scan_test)
+{
+    using namespace std::string_literals;
+
+    argh::options schema;
+    int config = schema.add("--config", nullptr, "FILE");
+    int verbose = schema.add("--verbose");
+    int heap = schema.add("-Xmx", nullptr, "SIZE");
+    int port = schema.add("-p", nullptr, "PORT");
+    int quiet = schema.add("-q");
+    int jar = schema.add("-jar", nullptr, "FILE");
+    int classpath = schema.add("-cp", nullptr, "PATH");
+
+    fake_proc proc;
+    proc.add("12", "server\0--conf\0/etc/server.conf\0-qp\0008080\0input\0"s);
+    proc.add("7", "java\0-Xmx4g\0-cp\0/opt/app/lib/*\0-jar\0app.jar\0--verbose\0"s);
+    proc.add("300", "");
+    proc.add("45", "tool\0--config=a\0--config=b\0-cplib\0--\0--verbose\0"s);
+    proc.add("self", "not a process\0"s);
+    std::filesystem::create_directory(proc.root + "/99");
+
+    for (int threads : {1, 4})
+    {
+        argh::process_scanner scanner(schema, threads, proc.root);
+        ASSERT_EQ(threads, scanner.threads());
+        argh::process_table table;
+
+        // Scan twice, to make sure the table and the buffers are reused cleanly.
+        for (int pass = 0; pass < 2; pass++)
+        {
+            ASSERT_TRUE(scanner.scan(table));
+            ASSERT_EQ(4, table.size());
+            ASSERT_EQ(7, table.pid(0));
+            ASSERT_EQ(12, table.pid(1));
+            ASSERT_EQ(45, table.pid(2));
+            ASSERT_EQ(300, table.pid(3));
+            ASSERT_EQ(-1, table.find(99));
+
+            int row = table.find(12);
+            ASSERT_EQ("server", table.command(row));
+            ASSERT_EQ("/etc/server.conf", table.value(row, config));
+            ASSERT_TRUE(table.has(row, quiet));
+            ASSERT_EQ("8080", table.value(row, port));
+            ASSERT_FALSE(table.has(row, verbose));
+
+            row = table.find(7);
+            ASSERT_EQ("4g", table.value(row, heap));
+            ASSERT_TRUE(table.has(row, jar));
+            ASSERT_EQ("app.jar", table.value(row, jar));
+            ASSERT_EQ("/opt/app/lib/*", table.value(row, classpath));
+            ASSERT_TRUE(table.has(row, verbose));
+            ASSERT_FALSE(table.has(row, quiet));
+
+            row = table.find(45);
+            ASSERT_EQ("b", table.value(row, config));
+            ASSERT_EQ("lib", table.value(row, classpath));
+            ASSERT_FALSE(table.has(row, verbose));
+
+            row = table.find(300);
+            ASSERT_EQ("", table.command(row));
+            ASSERT_FALSE(table.has(row, config));
+        }
+    }
+
+    argh::process_scanner missing(schema, 2, proc.root + "/missing");
+    argh::process_table table;
+    ASSERT_FALSE(missing.scan(table));
+    ASSERT_EQ(0, table.size());
+}
+
+// Test the argh::process_scanner class on the real /proc.
+// This test ensures that the test's own process is found, with its command.
+TEST(argh_proc_test, argh_proc_self_test)
+{
+    if (!std::filesystem::exists("/proc/self/cmdline"))
+        GTEST_SKIP() << "/proc is not mounted";
+
+    argh::options schema;
+    argh::process_scanner scanner(schema);
+    argh::process_table table;
+    ASSERT_TRUE(scanner.scan(table));
+
+    int row = table.find(getpid());
+    ASSERT_NE(-1, row);
+    std::string command;
+    std::getline(std::ifstream("/proc/self/cmdline"), command, '\0');
+    ASSERT_EQ(command, table.command(row));
+}
@@ -0,0 +1,125 @@
+// src/argh/tests/scanner.test.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh scanner.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/scanner.h"
+
+#include <string>
+#include <string_view>
+
+// A visitor that writes down every event it receives.
+struct recorder : argh::visitor
+{
+    std::string log;
+
+    void on_flag(std::string_view name)
+    {
+        log += "flag " + std::string(name) + ";";
+    }
+
+    void on_parameter(std::string_view name, std::string_view value)
+    {
+        log += "parameter " + std::string(name) + "=" + std::string(value) + ";";
+    }
+
+    void on_positional(std::string_view value, std::string_view owner)
+    {
+        log += "positional " + std::string(value) + "<" + std::string(owner) + ";";
+    }
+
+    void on_double_dash()
+    {
+        log += "--;";
+    }
+
+    void on_ambiguous(std::string_view name)
+    {
+        log += "ambiguous " + std::string(name) + ";";
+    }
+};
+
+// Test the argh::visit function.
+// This test ensures that the events are reported in order.
+TEST(argh_scanner_test, argh_scanner_events_test)
+{
+    char arg0[] = "./argh";
+    char arg1[] = "-ab";
+    char arg2[] = "file.txt";
+    char arg3[] = "--output=output.txt";
+    char arg4[] = "--verbose";
+    char arg5[] = "--";
+    char arg6[] = "-c";
+    char *argv[] = {arg0, arg1, arg2, arg3, arg4, arg5, arg6};
+
+    recorder events;
+    argh::visit(7, argv, events);
+    ASSERT_EQ("flag -a;flag -b;positional file.txt<-b;parameter --output=output.txt;flag --verbose;--;positional -c<;",
+              events.log);
+}
+
+// Test the argh::scanner class with a registry of known options.
+// This test ensures that abbreviations are resolved before they are reported.
+TEST(argh_scanner_test, argh_scanner_registry_test)
+{
+    argh::options opts;
+    opts.add("--verbose");
+    opts.add("--version");
+    opts.add("--output");
+
+    recorder events;
+    argh::scanner scan(&opts);
+    scan.scan("--out", events);
+    scan.scan("output.txt", events);
+    scan.scan("--ver", events);
+    ASSERT_EQ("flag --output;positional output.txt<--output;ambiguous --ver;flag --ver;", events.log);
+}
+
+// Test the argh::visitor struct.
+// This test ensures that a visitor only needs to handle the events it cares about.
+TEST(argh_scanner_test, argh_scanner_partial_visitor_test)
+{
+    struct counter : argh::visitor
+    {
+        int arguments = 0;
+        int flags = 0;
+        void on_argument(std::string_view, argh::token_kind) { arguments++; }
+        void on_flag(std::string_view) { flags++; }
+    };
+
+    counter count;
+    argh::scanner scan;
+    for (std::string_view arg : {"-abc", "", "file.txt", "--verbose"})
+    {
+        scan.scan(arg, count);
+    }
+    ASSERT_EQ(3, count.arguments);
+    ASSERT_EQ(4, count.flags);
+}
+
+// Test the argh::scanner class's copies.
+// This test ensures that a copy made after a short flag keeps its own owner for the next argument,
+// however the original goes on.
+TEST(argh_scanner_test, argh_scanner_copy_test)
+{
+    recorder events;
+    argh::scanner original;
+    original.scan("-ab", events);
+    argh::scanner copy = original;
+    original.scan("-x", events);
+    {
+        argh::scanner temporary = original;
+        copy = temporary;
+    }
+    original.scan("-y", events);
+    copy.scan("value", events);
+    ASSERT_EQ("flag -a;flag -b;flag -x;flag -y;positional value<-x;", events.log);
+}
@@ -0,0 +1,67 @@
+// src/argh/tests/small_vector.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh small_vector class.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/small_vector.h"
+
+#include <utility>
+
+// Test the argh::small_vector class.
+// This test ensures that the elements survive spilling from the inline storage to the heap.
+TEST(argh_small_vector_test, argh_small_vector_spill_test)
+{
+    argh::small_vector<int, 4> numbers;
+    for (int i = 0; i < 4; i++)
+        numbers.push_back(i);
+    ASSERT_FALSE(numbers.spilled());
+    ASSERT_EQ(4u, numbers.capacity());
+
+    for (int i = 4; i < 100; i++)
+        numbers.push_back(i);
+    ASSERT_TRUE(numbers.spilled());
+    ASSERT_EQ(100u, numbers.size());
+    for (int i = 0; i < 100; i++)
+        ASSERT_EQ(i, numbers[i]);
+
+    numbers.resize(10);
+    ASSERT_EQ(10u, numbers.size());
+    ASSERT_EQ(9, *(numbers.end() - 1));
+}
+
+// Test the argh::small_vector class copy and move operations.
+// This test ensures that inline and spilled vectors are copied and moved correctly.
+TEST(argh_small_vector_test, argh_small_vector_copy_move_test)
+{
+    argh::small_vector<char, 8> small, large;
+    small.append("abc", 3);
+    large.append("abcdefghijklmnop", 16);
+
+    argh::small_vector<char, 8> small_copy = small, large_copy = large;
+    ASSERT_EQ(3u, small_copy.size());
+    ASSERT_EQ('c', small_copy[2]);
+    ASSERT_EQ(16u, large_copy.size());
+    ASSERT_EQ('p', large_copy[15]);
+    ASSERT_NE(large.data(), large_copy.data());
+
+    const char *heap = large.data();
+    argh::small_vector<char, 8> small_moved = std::move(small), large_moved = std::move(large);
+    ASSERT_EQ(0u, small.size());
+    ASSERT_EQ(0u, large.size());
+    ASSERT_EQ('c', small_moved[2]);
+    ASSERT_EQ(heap, large_moved.data());
+
+    small_moved = large_copy;
+    ASSERT_EQ(16u, small_moved.size());
+    large_moved = std::move(small_copy);
+    ASSERT_EQ(3u, large_moved.size());
+    ASSERT_FALSE(large_moved.spilled());
+}
@@ -0,0 +1,232 @@
+// src/argh/tests/snapshot.test.cc
+// v0.3.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for the argh snapshot class.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/argh.h"
+#include "argh/snapshot.h"
+#include "argh/tests/memory_usage.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Checks that a snapshot answers every query as the argh instance it was published from.
+//
+//   * argh::argh &args                - The argh instance.
+//   * const argh::snapshot &published - The snapshot.
+//
+//   * return (bool) - True if every answer is the same.
+static bool same_answers(argh::argh &args, const argh::snapshot &published)
+{
+    if (args.size() != published.size())
+        return false;
+    for (int i = 0; i < args.size(); i++)
+    {
+        if (args.positional(i) != published.positional(i))
+            return false;
+    }
+    for (std::string_view name : args.flags())
+    {
+        if (!published.has_flag(name))
+            return false;
+    }
+    for (auto [name, value] : args.parameters())
+    {
+        if (published.parameter_value(name) != value)
+            return false;
+    }
+    return true;
+}
+
+// Answers a query for every name, then for every positional argument, as a worker would.
+//
+//   * store &queried                        - The argh instance or the snapshot.
+//   * const std::vector<std::string> &names - The names of the flags and parameters.
+//
+//   * return (std::size_t) - The total length of the answers, so that they are used.
+template <typename store>
+static std::size_t query(store &queried, const std::vector<std::string> &names)
+{
+    std::size_t found = 0;
+    for (const std::string &name : names)
+        found += queried.parameter_value(name).length() + queried.has_flag(name);
+    for (int i = 0; i < queried.size(); i++)
+        found += queried.positional(i).length();
+    return found;
+}
+
+// Forks workers that each query a store, and returns how much they dirtied while querying.
+//
+//   * store &queried                        - The argh instance or the snapshot.
+//   * const std::vector<std::string> &names - The names of the flags and parameters.
+//   * int workers                           - The number of workers.
+//
+//   * return (long int) - The most that any worker dirtied, in kilobytes, or -1 if a worker failed.
+template <typename store>
+static long int dirtied_kb(store &queried, const std::vector<std::string> &names, int workers)
+{
+    std::vector<std::pair<pid_t, int>> children;
+    for (int i = 0; i < workers; i++)
+    {
+        int channel[2];
+        if (pipe(channel) != 0)
+            return -1;
+        pid_t worker = fork();
+        if (worker == 0)
+        {
+            argh::memory_usage before = argh::measure_process();
+            volatile std::size_t found = query(queried, names);
+            (void)found;
+            long int dirtied = argh::measure_process().private_dirty_kb - before.private_dirty_kb;
+            _exit(write(channel[1], &dirtied, sizeof(dirtied)) == sizeof(dirtied) ? 0 : 1);
+        }
+        close(channel[1]);
+        if (worker == -1)
+            return -1;
+        children.push_back({worker, channel[0]});
+    }
+
+    long int most = 0;
+    for (auto [worker, channel] : children)
+    {
+        long int dirtied = -1;
+        int status;
+        if (read(channel, &dirtied, sizeof(dirtied)) != sizeof(dirtied) || waitpid(worker, &status, 0) != worker ||
+            !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            most = -1;
+        else if (most != -1 && dirtied > most)
+            most = dirtied;
+        close(channel);
+    }
+    return most;
+}
+
+// Test the argh::snapshot class.
+// This test ensures that a snapshot answers queries as the argh instance does.
+TEST(argh_snapshot_test, argh_snapshot_publish_test)
+{
+    argh::argh args(std::vector<std::string>{"-v", "--output=out.txt", "--level", "3", "input.txt", "--", "-x"});
+    args.mark_parameter("--level");
+
+    argh::snapshot published;
+    ASSERT_EQ(nullptr, published.data());
+    ASSERT_FALSE(published.has_flag("-v"));
+    ASSERT_EQ(0, published.size());
+
+    ASSERT_TRUE(published.publish(args));
+    ASSERT_NE(-1, published.fd());
+    ASSERT_TRUE(same_answers(args, published));
+    ASSERT_TRUE(published.has_flag("-v"));
+    ASSERT_TRUE(published.has_flag("--output"));
+    ASSERT_FALSE(published.has_flag("--verbose"));
+    ASSERT_EQ("out.txt", published.parameter_value("--output"));
+    ASSERT_EQ("3", published.parameter_value("--level"));
+    ASSERT_EQ("", published.parameter_value("-v"));
+    ASSERT_EQ(2, published.size());
+    ASSERT_EQ("input.txt", published.positional(0));
+    ASSERT_EQ("-x", published.positional(1));
+    ASSERT_EQ("", published.positional(2));
+
+    // The region is read-only.
+    ASSERT_EQ(-1, mprotect((void *)published.data(), published.bytes(), PROT_READ | PROT_WRITE));
+
+    argh::snapshot moved(std::move(published));
+    ASSERT_EQ(nullptr, published.data());
+    ASSERT_EQ("out.txt", moved.parameter_value("--output"));
+}
+
+// Test the argh::snapshot::attach method.
+// This test ensures that a region can be mapped again by its descriptor, and that
+// unsealed files, even with the same contents, and sealed garbage are refused.
+TEST(argh_snapshot_test, argh_snapshot_attach_test)
+{
+    argh::argh args(std::vector<std::string>{"-abc", "--name=value", "file"});
+    argh::snapshot published;
+    ASSERT_TRUE(published.publish(args));
+
+    argh::snapshot attached;
+    ASSERT_TRUE(attached.attach(published.fd()));
+    ASSERT_NE(published.data(), attached.data());
+    ASSERT_TRUE(same_answers(args, attached));
+
+    int copy = memfd_create("copy", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ASSERT_EQ((ssize_t)published.bytes(), write(copy, published.data(), published.bytes()));
+    ASSERT_FALSE(attached.attach(copy));
+    ASSERT_EQ(0, fcntl(copy, F_ADD_SEALS, F_SEAL_WRITE | F_SEAL_SHRINK));
+    ASSERT_TRUE(attached.attach(copy));
+    close(copy);
+
+    int garbage = memfd_create("garbage", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ASSERT_EQ(4096, write(garbage, std::string(4096, 'x').data(), 4096));
+    ASSERT_EQ(0, fcntl(garbage, F_ADD_SEALS, F_SEAL_WRITE | F_SEAL_SHRINK));
+    ASSERT_FALSE(attached.attach(garbage));
+    ASSERT_TRUE(attached.has_flag("-b"));
+    close(garbage);
+}
+
+// Test the argh::snapshot class with forked workers.
+// This test ensures that the workers read the master's pages without copying any of them,
+// and that they dirty less memory than workers querying the argh instance itself, whose
+// parameter queries mark the positional arguments that the parameters own.
+TEST(argh_snapshot_test, argh_snapshot_fork_test)
+{
+    std::vector<std::string> argv;
+    for (int i = 0; i < 20000; i++)
+    {
+        argv.push_back("--level-" + std::to_string(i % 300) + "=" + std::to_string(i));
+        argv.push_back("--option-" + std::to_string(i % 500));
+        argv.push_back("input-file-" + std::to_string(i) + ".txt");
+    }
+    argh::argh args(std::move(argv));
+    argh::snapshot published;
+    ASSERT_TRUE(published.publish(args));
+    ASSERT_GT(published.bytes(), 64 * 1024);
+
+    std::vector<pid_t> workers;
+    for (int i = 0; i < 8; i++)
+    {
+        pid_t worker = fork();
+        if (worker == 0)
+        {
+            if (!same_answers(args, published))
+                _exit(1);
+            argh::memory_usage usage = argh::measure_mapping(published.data());
+            if (usage.rss_kb == 0 || usage.private_dirty_kb != 0 || usage.anonymous_kb != 0)
+                _exit(2);
+            _exit(0);
+        }
+        ASSERT_NE(-1, worker);
+        workers.push_back(worker);
+    }
+
+    for (pid_t worker : workers)
+    {
+        int status;
+        ASSERT_EQ(worker, waitpid(worker, &status, 0));
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(0, WEXITSTATUS(status));
+    }
+
+    std::vector<std::string> names;
+    for (std::string_view name : args.flags())
+        names.emplace_back(name);
+    long int from_args = dirtied_kb(args, names, 4);
+    long int from_snapshot = dirtied_kb(published, names, 4);
+    ASSERT_NE(-1, from_args);
+    ASSERT_NE(-1, from_snapshot);
+    ASSERT_LT(from_snapshot, from_args);
+}
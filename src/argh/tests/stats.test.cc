@@ -0,0 +1,96 @@
+// src/argh/tests/stats.test.cc
+// v0.2.1
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh parse statistics.
+// It is built against the //argh:argh_stats target, which builds argh.cc with ARGH_STATS.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/argh.h"
+#include "argh/tests/alloc_counter.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Test the argh::argh class's method stats.
+// This test ensures that tokens, copies, scans and queries are counted.
+TEST(argh_stats_test, argh_stats_count_test)
+{
+    std::string argv[] = {"test", "-abc", "--verbose", "--output=output.txt", "-o", "input.txt", "--", "-v"};
+    argh::argh args(8, argv);
+
+    const argh::parse_stats &stats = args.stats();
+    ASSERT_EQ(3, stats.tokens[(int)argh::token_kind::positional]);
+    ASSERT_EQ(2, stats.tokens[(int)argh::token_kind::short_cluster]);
+    ASSERT_EQ(1, stats.tokens[(int)argh::token_kind::long_option]);
+    ASSERT_EQ(1, stats.tokens[(int)argh::token_kind::long_with_value]);
+    ASSERT_EQ(1, stats.tokens[(int)argh::token_kind::double_dash]);
+    // Every argument is copied into the inline text buffer, which needs no allocation.
+    ASSERT_EQ(4 + 4 + 9 + 19 + 2 + 9 + 2 + 2, stats.bytes_copied);
+    ASSERT_EQ(0, stats.allocations);
+    ASSERT_GE(stats.constructor_ns, 0);
+    ASSERT_EQ(0, stats.queries);
+
+    ASSERT_STREQ("input.txt", args("-o").c_str());
+    ASSERT_TRUE(args["-a"]);
+    ASSERT_EQ(2, stats.queries);
+    ASSERT_GT(stats.mark_parameter_scans, 0);
+
+    std::string line = stats.to_string();
+    ASSERT_EQ(0u, line.find("argh: "));
+    ASSERT_NE(std::string::npos, line.find(" tokens.positional=3"));
+    ASSERT_NE(std::string::npos, line.find(" queries=2"));
+    ASSERT_EQ(std::string::npos, line.find('\n'));
+}
+
+// Test the argh::argh class's method stats with each way of storing the arguments.
+// This test ensures that the counted allocations match the real ones, and that
+// only copied arguments count as copied bytes.
+TEST(argh_stats_test, argh_stats_storage_test)
+{
+    std::vector<std::string> argv;
+    for (int i = 0; i < 100; i++)
+    {
+        argv.push_back("--set-" + std::to_string(i) + "=" + std::to_string(i));
+        argv.push_back("-" + std::string(1, 'a' + i % 26));
+        argv.push_back("input-" + std::to_string(i) + ".txt");
+    }
+    std::vector<std::string_view> views(argv.begin(), argv.end());
+    long int length = 0;
+    for (const std::string &arg : argv)
+        length += arg.length();
+
+    // The names are interned by the process, not by the instances, so intern them first.
+    argh::argh warm(argv.size(), argv.data());
+
+    argh::alloc_counter copied_counter;
+    argh::argh copied(argv.size(), argv.data());
+    ASSERT_EQ(copied_counter.allocations(), copied.stats().allocations);
+    ASSERT_EQ(length, copied.stats().bytes_copied);
+
+    argh::alloc_counter borrowed_counter;
+    argh::argh borrowed{std::span<const std::string_view>(views)};
+    ASSERT_EQ(borrowed_counter.allocations(), borrowed.stats().allocations);
+    ASSERT_EQ(0, borrowed.stats().bytes_copied);
+
+    std::vector<std::string> moved = argv;
+    argh::alloc_counter owned_counter;
+    argh::argh owned(std::move(moved));
+    ASSERT_EQ(owned_counter.allocations(), owned.stats().allocations);
+    ASSERT_EQ(borrowed.stats().allocations + 1, owned.stats().allocations);
+    ASSERT_EQ(0, owned.stats().bytes_copied);
+
+    std::vector<std::string> small = {"-v", "--level=3", "input.txt"};
+    argh::argh small_owned(std::move(small));
+    ASSERT_EQ(1, small_owned.stats().allocations);
+    ASSERT_EQ(0, small_owned.stats().bytes_copied);
+}
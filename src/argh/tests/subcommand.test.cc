@@ -0,0 +1,165 @@
+// src/argh/tests/subcommand.test.cc
+// v0.3.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh subcommand utility.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/options.h"
+#include "argh/subcommand.h"
+
+#include <vector>
+
+// Test the argh::command_tree class's methods add and find.
+// This test ensures that registered subcommands can be looked up by name
+// under the correct parent only.
+TEST(argh_subcommand_test, argh_subcommand_find_test)
+{
+    argh::command_tree tree;
+    int remote = tree.add("remote");
+    int remote_add = tree.add("add", remote);
+    int add = tree.add("add");
+
+    ASSERT_EQ(remote, tree.find(argh::command_tree::root, "remote"));
+    ASSERT_EQ(add, tree.find(argh::command_tree::root, "add"));
+    ASSERT_EQ(remote_add, tree.find(remote, "add"));
+    ASSERT_EQ(-1, tree.find(remote, "remote"));
+    ASSERT_EQ(-1, tree.find(argh::command_tree::root, "rem"));
+    ASSERT_EQ(-1, tree.find(argh::command_tree::root, "remotes"));
+    ASSERT_EQ(-1, tree.find(argh::command_tree::root, ""));
+
+    ASSERT_STREQ("add", tree.name(remote_add).c_str());
+    ASSERT_EQ(remote, tree.parent(remote_add));
+    ASSERT_EQ(-1, tree.parent(argh::command_tree::root));
+}
+
+// Test the argh::command_tree class's method add with bad input.
+// This test ensures that a name registered twice keeps its id, and that unknown parents are refused.
+TEST(argh_subcommand_test, argh_subcommand_add_test)
+{
+    argh::command_tree tree;
+    int remote = tree.add("remote");
+    int remote_add = tree.add("add", remote);
+
+    ASSERT_EQ(remote, tree.add("remote"));
+    ASSERT_EQ(remote_add, tree.add("add", remote));
+    ASSERT_EQ(remote_add, tree.find(remote, "add"));
+
+    ASSERT_EQ(-1, tree.add("orphan", -1));
+    ASSERT_EQ(-1, tree.add("orphan", remote_add + 1));
+    ASSERT_EQ(remote_add + 1, tree.add("status"));
+
+    // Unknown ids are answered with nothing, rather than read out of bounds.
+    std::vector<int> ids;
+    tree.complete(-1, "", ids);
+    tree.complete(remote_add + 2, "", ids);
+    ASSERT_TRUE(ids.empty());
+    ASSERT_EQ(-1, tree.find(remote_add + 2, "add"));
+    ASSERT_EQ(-1, tree.find(-1, "remote"));
+    ASSERT_EQ("", tree.name(remote_add + 2));
+    ASSERT_EQ(-1, tree.parent(-5));
+    argh::options opts;
+    ASSERT_FALSE(tree.use_options(remote_add + 2, opts));
+    ASSERT_TRUE(tree.use_options(argh::command_tree::root, opts));
+}
+
+// Test the argh::command_tree class's method dispatch.
+// This test ensures that each level of the command line
+// sees only its own options and positional arguments.
+TEST(argh_subcommand_test, argh_subcommand_dispatch_test)
+{
+    argh::command_tree tree;
+    int remote = tree.add("remote");
+    int remote_add = tree.add("add", remote);
+
+    char prg[] = "prg", v[] = "-v", remote_s[] = "remote", add_s[] = "add";
+    char f[] = "-f", name[] = "origin", dd[] = "--", add_again[] = "add";
+
+    char *argv_a[] = {prg};
+    auto levels_a = tree.dispatch(1, argv_a);
+    ASSERT_EQ(1u, levels_a.size());
+    ASSERT_EQ(argh::command_tree::root, levels_a[0].id);
+
+    char *argv_b[] = {prg, v, remote_s, add_s, f, name};
+    auto levels_b = tree.dispatch(6, argv_b);
+    ASSERT_EQ(3u, levels_b.size());
+    ASSERT_EQ(argh::command_tree::root, levels_b[0].id);
+    ASSERT_EQ(remote, levels_b[1].id);
+    ASSERT_EQ(remote_add, levels_b[2].id);
+    ASSERT_TRUE(levels_b[0].args["-v"]);
+    ASSERT_FALSE(levels_b[0].args["-f"]);
+    ASSERT_EQ(0, levels_b[1].args.size());
+    ASSERT_FALSE(levels_b[2].args["-v"]);
+    ASSERT_TRUE(levels_b[2].args["-f"]);
+    ASSERT_STREQ("origin", levels_b[2].args[0].c_str());
+
+    // Subcommand names after "--" are positional arguments.
+    char *argv_c[] = {prg, remote_s, dd, add_again};
+    auto levels_c = tree.dispatch(4, argv_c);
+    ASSERT_EQ(2u, levels_c.size());
+    ASSERT_EQ(remote, levels_c[1].id);
+    ASSERT_STREQ("add", levels_c[1].args[0].c_str());
+
+    // Unknown positional arguments stay with the current level.
+    char *argv_d[] = {prg, name, remote_s};
+    auto levels_d = tree.dispatch(3, argv_d);
+    ASSERT_EQ(2u, levels_d.size());
+    ASSERT_STREQ("origin", levels_d[0].args[0].c_str());
+    ASSERT_EQ(0, levels_d[1].args.size());
+}
+
+// Test the argh::command_tree class's method dispatch with a registry of options at each level.
+// This test ensures that each level resolves its own options, that option values are never
+// taken for subcommands, and that the levels borrow the original arguments.
+TEST(argh_subcommand_test, argh_subcommand_options_test)
+{
+    argh::options root_options;
+    root_options.add("-o", nullptr, "FILE");
+    root_options.add("--output", nullptr, "FILE");
+    argh::options remote_options;
+    remote_options.add("--verbose");
+    argh::options add_options;
+    add_options.add("--track", nullptr, "BRANCH");
+
+    argh::command_tree tree;
+    ASSERT_TRUE(tree.use_options(argh::command_tree::root, root_options));
+    int remote = tree.add("remote", argh::command_tree::root, remote_options);
+    int remote_add = tree.add("add", remote, add_options);
+
+    char prg[] = "prg", o[] = "-qo", out[] = "--out", remote_s[] = "remote", verb[] = "--verb";
+    char add_s[] = "add", track[] = "--tr", name[] = "origin";
+
+    char *argv_a[] = {prg, o, remote_s, remote_s, verb, add_s, track, add_s, name};
+    auto levels_a = tree.dispatch(9, argv_a);
+    ASSERT_EQ(3u, levels_a.size());
+    ASSERT_EQ(argh::command_tree::root, levels_a[0].id);
+    ASSERT_EQ(remote, levels_a[1].id);
+    ASSERT_EQ(remote_add, levels_a[2].id);
+    ASSERT_TRUE(levels_a[0].args["-o"]);
+    ASSERT_STREQ("remote", levels_a[0].args[0].c_str());
+    ASSERT_TRUE(levels_a[1].args["--verbose"]);
+    ASSERT_EQ(0, levels_a[1].args.size());
+    ASSERT_TRUE(levels_a[2].args["--track"]);
+    ASSERT_EQ(2, levels_a[2].args.size());
+    ASSERT_STREQ("add", levels_a[2].args[0].c_str());
+
+    // Nothing is copied: each level views the original arguments.
+    ASSERT_EQ(argv_a[1], levels_a[0].args.raw()[0].data());
+    ASSERT_EQ(argv_a[8], levels_a[2].args.raw()[2].data());
+
+    char *argv_b[] = {prg, out, remote_s};
+    auto levels_b = tree.dispatch(3, argv_b);
+    ASSERT_EQ(1u, levels_b.size());
+    ASSERT_TRUE(levels_b[0].args["--output"]);
+    ASSERT_STREQ("remote", levels_b[0].args[0].c_str());
+
+    auto levels_c = tree.dispatch(0, argv_b);
+    ASSERT_EQ(1u, levels_c.size());
+    ASSERT_EQ(0, levels_c[0].args.size());
+}
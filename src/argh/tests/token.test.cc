@@ -0,0 +1,52 @@
+// src/argh/tests/token.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh token classifier.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/token.h"
+
+// Test the argh::classify function.
+// This test ensures that every kind of token is recognized.
+TEST(argh_token_test, argh_token_kind_test)
+{
+    ASSERT_EQ(argh::token_kind::empty, argh::classify("").kind);
+    ASSERT_EQ(argh::token_kind::dash, argh::classify("-").kind);
+    ASSERT_EQ(argh::token_kind::double_dash, argh::classify("--").kind);
+    ASSERT_EQ(argh::token_kind::short_cluster, argh::classify("-v").kind);
+    ASSERT_EQ(argh::token_kind::short_cluster, argh::classify("-abc").kind);
+    ASSERT_EQ(argh::token_kind::short_cluster, argh::classify("-a-b").kind);
+    ASSERT_EQ(argh::token_kind::short_with_value, argh::classify("-o=output.txt").kind);
+    ASSERT_EQ(argh::token_kind::short_with_value, argh::classify("-=").kind);
+    ASSERT_EQ(argh::token_kind::long_option, argh::classify("--verbose").kind);
+    ASSERT_EQ(argh::token_kind::long_option, argh::classify("---").kind);
+    ASSERT_EQ(argh::token_kind::long_with_value, argh::classify("--output=output.txt").kind);
+    ASSERT_EQ(argh::token_kind::long_with_value, argh::classify("--=").kind);
+    ASSERT_EQ(argh::token_kind::positional, argh::classify("output.txt").kind);
+    ASSERT_EQ(argh::token_kind::positional, argh::classify("a-b=c").kind);
+    ASSERT_EQ(argh::token_kind::positional, argh::classify("=").kind);
+}
+
+// Test the argh::classify function's split offsets.
+// This test ensures that options with a value are split at the first '='.
+TEST(argh_token_test, argh_token_offset_test)
+{
+    argh::token long_value = argh::classify("--output=a=b");
+    ASSERT_EQ(8u, long_value.name_end);
+    ASSERT_EQ(9u, long_value.value_begin);
+
+    argh::token short_value = argh::classify("-o=");
+    ASSERT_EQ(2u, short_value.name_end);
+    ASSERT_EQ(3u, short_value.value_begin);
+
+    argh::token flag = argh::classify("--verbose");
+    ASSERT_EQ(9u, flag.name_end);
+    ASSERT_EQ(10u, flag.value_begin);
+}
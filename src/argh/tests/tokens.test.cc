@@ -0,0 +1,134 @@
+// src/argh/tests/tokens.test.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for the argh lazy tokenizers.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/tokens.h"
+
+#include <istream>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Collects the text of each argument that a tokenizer yields.
+//
+//   * argh::generator<argh::classified_argument> tokens - The tokenizer.
+//
+//   * return (std::vector<std::string>) - The text of each argument.
+static std::vector<std::string> texts(argh::generator<argh::classified_argument> tokens)
+{
+    std::vector<std::string> result;
+    for (const argh::classified_argument &arg : tokens)
+        result.emplace_back(arg.text);
+    return result;
+}
+
+// Test the argh::tokenize function.
+// This test ensures that each argument is classified as the argh class would classify it.
+TEST(argh_tokens_test, argh_tokens_argv_test)
+{
+    char arg0[] = "prg";
+    char arg1[] = "-abc";
+    char arg2[] = "--output=out.txt";
+    char arg3[] = "";
+    char arg4[] = "--verbose";
+    char arg5[] = "--";
+    char arg6[] = "-x";
+    char *argv[] = {arg0, arg1, arg2, arg3, arg4, arg5, arg6};
+
+    std::vector<argh::classified_argument> args;
+    for (const argh::classified_argument &arg : argh::tokenize(7, argv))
+        args.push_back(arg);
+
+    ASSERT_EQ(5, args.size());
+    ASSERT_EQ(argh::token_kind::short_cluster, args[0].kind);
+    ASSERT_EQ("-abc", args[0].name);
+    ASSERT_EQ(argh::token_kind::long_with_value, args[1].kind);
+    ASSERT_EQ("--output", args[1].name);
+    ASSERT_EQ("out.txt", args[1].value);
+    ASSERT_EQ(argh::token_kind::long_option, args[2].kind);
+    ASSERT_EQ("--verbose", args[2].name);
+    ASSERT_EQ(argh::token_kind::double_dash, args[3].kind);
+    ASSERT_EQ(argh::token_kind::positional, args[4].kind);
+    ASSERT_EQ("-x", args[4].text);
+    ASSERT_EQ(arg6, args[4].text.data());
+}
+
+// Test the argh::tokenize function with a registry of known options.
+// This test ensures that abbreviations are resolved, and that the consumer can stop early.
+TEST(argh_tokens_test, argh_tokens_span_test)
+{
+    argh::options opts;
+    opts.add("--verbose");
+    std::string_view argv[] = {"--verb", "input.txt", "--never-reached"};
+
+    int pulled = 0;
+    for (const argh::classified_argument &arg : argh::tokenize(argv, &opts) | std::views::take(2))
+    {
+        if (pulled++ == 0)
+            ASSERT_EQ("--verbose", arg.name);
+        else
+            ASSERT_EQ("input.txt", arg.text);
+    }
+    ASSERT_EQ(2, pulled);
+}
+
+// Test the argh::tokenize_command function.
+// This test ensures that a command string is split into arguments, with quotes and backslashes undone.
+TEST(argh_tokens_test, argh_tokens_command_test)
+{
+    std::vector<std::string> expected = {"-o", "my file.txt", "it's", "a\"b", "--name=x y"};
+    ASSERT_EQ(expected, texts(argh::tokenize_command("  -o 'my file.txt' it\\'s \"a\\\"b\" --name=\"x y\"")));
+    ASSERT_EQ(std::vector<std::string>{"back\\slash"}, texts(argh::tokenize_command("\"\" back\\\\slash")));
+    ASSERT_TRUE(texts(argh::tokenize_command(" \t\n")).empty());
+    ASSERT_EQ(std::vector<std::string>{"unterminated quote"}, texts(argh::tokenize_command("'unterminated quote")));
+}
+
+// Test the argh::tokenize_file function.
+// This test ensures that a response file is only read as far as the consumer pulls.
+TEST(argh_tokens_test, argh_tokens_file_test)
+{
+    std::istringstream file("--level=3\n-v\n\ninput.txt\nrest of the file");
+
+    argh::generator<argh::classified_argument> tokens = argh::tokenize_file(file);
+    auto it = tokens.begin();
+    ASSERT_EQ("--level", (*it).name);
+    ASSERT_EQ("3", (*it).value);
+    ++it;
+    ASSERT_EQ(argh::token_kind::short_cluster, (*it).kind);
+    ++it;
+    ASSERT_EQ("input.txt", (*it).text);
+
+    std::string rest;
+    std::getline(file, rest);
+    ASSERT_EQ("rest of the file", rest);
+}
+
+// Test the argh::tokenize_command function with validation turned on.
+// This test ensures that invalid arguments are yielded with their problem, and not classified.
+TEST(argh_tokens_test, argh_tokens_validation_test)
+{
+    argh::options opts;
+    opts.validate_text();
+
+    std::vector<argh::classified_argument> args;
+    for (const argh::classified_argument &arg : argh::tokenize_command("-v '\x07' \xe2\x82 --ok", &opts))
+        args.push_back(arg);
+
+    ASSERT_EQ(4, args.size());
+    ASSERT_EQ(argh::text_problem::none, args[0].problem);
+    ASSERT_EQ(argh::text_problem::control_character, args[1].problem);
+    ASSERT_EQ(argh::token_kind::empty, args[1].kind);
+    ASSERT_EQ(argh::text_problem::invalid_utf8, args[2].problem);
+    ASSERT_EQ(argh::token_kind::long_option, args[3].kind);
+}
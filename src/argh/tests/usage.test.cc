@@ -0,0 +1,35 @@
+// src/argh/tests/usage.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the unit tests for the argh usage utility.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/usage.h"
+
+// Test the argh::usage function.
+// This test ensures that the usage message lists every registered option,
+// with its value and description aligned in columns.
+TEST(argh_usage_test, argh_usage_render_test)
+{
+    argh::options opts_a;
+    ASSERT_STREQ("Usage: prg\n", argh::usage("prg", opts_a).c_str());
+
+    argh::options opts_b;
+    opts_b.add("-v", "Print the version.");
+    opts_b.add("--output", "Write the output to <file>.", "file");
+    opts_b.add("--quiet");
+    ASSERT_STREQ("Usage: prg [options]\n"
+                 "\n"
+                 "Options:\n"
+                 "  -v               Print the version.\n"
+                 "  --output <file>  Write the output to <file>.\n"
+                 "  --quiet\n",
+                 argh::usage("prg", opts_b).c_str());
+}
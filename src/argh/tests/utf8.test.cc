@@ -0,0 +1,87 @@
+// src/argh/tests/utf8.test.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the unit tests for the argh text validation.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include <gtest/gtest.h>
+
+#include "argh/utf8.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+// The implementations to test, besides the scalar one that the others are compared against.
+static std::vector<argh::text_checker> checkers()
+{
+    std::vector<argh::text_checker> result = {argh::text_checker::scalar, argh::text_checker::best};
+    for (argh::text_checker checker : {argh::text_checker::sse4, argh::text_checker::avx2})
+    {
+        if (argh::text_checker_supported(checker))
+            result.push_back(checker);
+    }
+    return result;
+}
+
+// Test the argh::check_text function with known arguments.
+// This test ensures that each implementation accepts valid text and catches each kind of error,
+// wherever it falls in a block.
+TEST(argh_utf8_test, argh_utf8_known_test)
+{
+    const std::vector<std::string> valid = {
+        "", "--output=out.txt", "caf\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xed\x9f\xbf", "\xf4\x8f\xbf\xbf"};
+    const std::vector<std::string> invalid = {
+        "\x80", "\xc3", "\xc3\x28", "\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf0\x80\x80\xaf",
+        "\xf4\x90\x80\x80", "\xf8\x88\x80\x80\x80", "\xff", "\xe2\x82", "\xf0\x9f\x98"};
+    const std::vector<std::string> control = {"a\tb", "line\n", std::string("nul\0", 4), "\x7f", "\x1b[31m"};
+
+    for (argh::text_checker checker : checkers())
+    {
+        // Shift each case across the block boundaries.
+        for (int offset : {0, 1, 13, 14, 15, 16, 29, 30, 31, 32, 60})
+        {
+            std::string padding(offset, 'a');
+            for (const std::string &text : valid)
+                ASSERT_EQ(argh::text_problem::none, argh::check_text(padding + text, checker)) << offset;
+            for (const std::string &text : invalid)
+            {
+                ASSERT_EQ(argh::text_problem::invalid_utf8, argh::check_text(padding + text, checker)) << offset;
+                ASSERT_EQ(argh::text_problem::invalid_utf8, argh::check_text(padding + text + "tail", checker)) << offset;
+            }
+            for (const std::string &text : control)
+                ASSERT_EQ(argh::text_problem::control_character, argh::check_text(padding + text, checker)) << offset;
+        }
+    }
+}
+
+// Test the argh::check_text function with random arguments.
+// This test ensures that the vectorized implementations agree with the scalar one.
+TEST(argh_utf8_test, argh_utf8_random_test)
+{
+    const std::vector<std::string> pieces = {
+        "a", "-", "=", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\x80", "\xc3", "\xe2", "\xf0", "\xed\xa0", "\x0a"};
+    std::mt19937 random(47);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string text;
+        int count = random() % 40;
+        for (int k = 0; k < count; k++)
+        {
+            if (random() % 8 == 0)
+                text += (char)(random() % 256);
+            else
+                text += pieces[random() % pieces.size()];
+        }
+
+        argh::text_problem expected = argh::check_text(text, argh::text_checker::scalar);
+        for (argh::text_checker checker : checkers())
+            ASSERT_EQ(expected, argh::check_text(text, checker)) << i;
+    }
+}
@@ -0,0 +1,113 @@
+// src/argh/token.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the token classifier.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "token.h"
+#include "config.h"
+
+#include <array>
+#include <string_view>
+
+namespace argh
+{
+    // The tables of the state machine.
+    namespace token_detail
+    {
+        // The classes of characters that the state machine distinguishes.
+        enum char_class : unsigned char
+        {
+            other_char,
+            dash_char,
+            equals_char,
+            char_class_count
+        };
+
+        // The states of the state machine.
+        // Every state at or past the first final state ends the scan early.
+        enum state : unsigned char
+        {
+            // Nothing has been read yet.
+            start,
+            // "-" has been read.
+            one_dash,
+            // "--" has been read.
+            two_dashes,
+            // "-" and at least one more character have been read.
+            in_short,
+            // "--" and at least one more character have been read.
+            in_long,
+            // The first final state. The token is a positional argument.
+            found_positional,
+            // A single-dash option followed by '='.
+            found_short_value,
+            // A double-dash option followed by '='.
+            found_long_value,
+            state_count
+        };
+
+        // Maps every byte to its character class.
+        ARGH_INLINE constexpr std::array<unsigned char, 256> char_classes = []() {
+            std::array<unsigned char, 256> classes{};
+            classes['-'] = dash_char;
+            classes['='] = equals_char;
+            return classes;
+        }();
+
+        // The transition table, indexed by state and then by character class.
+        ARGH_INLINE constexpr unsigned char transitions[found_positional][char_class_count] = {
+            //                other             dash        equals
+            /* start      */ {found_positional, one_dash,   found_positional},
+            /* one_dash   */ {in_short,         two_dashes, found_short_value},
+            /* two_dashes */ {in_long,          in_long,    found_long_value},
+            /* in_short   */ {in_short,         in_short,   found_short_value},
+            /* in_long    */ {in_long,          in_long,    found_long_value},
+        };
+
+        // The kind of token for each state that the scan can end in.
+        ARGH_INLINE constexpr token_kind kinds[state_count] = {
+            /* start             */ token_kind::empty,
+            /* one_dash          */ token_kind::dash,
+            /* two_dashes        */ token_kind::double_dash,
+            /* in_short          */ token_kind::short_cluster,
+            /* in_long           */ token_kind::long_option,
+            /* found_positional  */ token_kind::positional,
+            /* found_short_value */ token_kind::short_with_value,
+            /* found_long_value  */ token_kind::long_with_value,
+        };
+    }
+
+    // Classifies a single token of the argv vector.
+    // The classifier is a table-driven state machine that reads each character at most once,
+    // and stops as soon as the kind of the token is known.
+    //
+    //   * std::string_view arg - The token to classify.
+    //
+    //   * return (token) - The classified token.
+    ARGH_INLINE token classify(std::string_view arg)
+    {
+        using namespace token_detail;
+
+        unsigned int length = arg.length();
+        unsigned int i = 0;
+        unsigned char current = start;
+        while (i < length)
+        {
+            current = transitions[current][char_classes[(unsigned char)arg[i]]];
+            if (current >= found_positional)
+                break;
+            i++;
+        }
+
+        if (current == found_short_value || current == found_long_value)
+            return {kinds[current], i, i + 1};
+        return {kinds[current], length, length + 1};
+    }
+}
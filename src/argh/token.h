@@ -0,0 +1,73 @@
+// src/argh/token.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the token classifier headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef TOKEN_H
+#define TOKEN_H
+
+#include <string_view>
+
+namespace argh
+{
+    // The kinds of tokens that can appear in the argv vector.
+    enum class token_kind : unsigned char
+    {
+        // An empty string. It is ignored.
+        empty,
+        // A single dash: "-". It is a positional argument.
+        dash,
+        // A double dash: "--". All following arguments are positional arguments.
+        double_dash,
+        // A single dash followed by one or more single-letter flags: "-abc".
+        short_cluster,
+        // A single-dash option with a value: "-o=output.txt".
+        short_with_value,
+        // A double dash followed by a word: "--verbose".
+        long_option,
+        // A double-dash option with a value: "--output=output.txt".
+        long_with_value,
+        // Anything else: "output.txt".
+        positional
+    };
+
+    // The number of kinds of tokens.
+    constexpr int token_kind_count = (int)token_kind::positional + 1;
+
+    // A classified token.
+    // For options with a value, the name is [0, name_end) and the value is [value_begin, end).
+    // Otherwise, name_end is the length of the token and value_begin is one past it.
+    struct token
+    {
+        // The kind of the token.
+        token_kind kind;
+
+        // The end of the option's name.
+        unsigned int name_end;
+
+        // The start of the option's value.
+        unsigned int value_begin;
+    };
+
+    // Classifies a single token of the argv vector.
+    // The classifier is a table-driven state machine that reads each character at most once,
+    // and stops as soon as the kind of the token is known.
+    //
+    //   * std::string_view arg - The token to classify.
+    //
+    //   * return (token) - The classified token.
+    token classify(std::string_view arg);
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "token.cc"
+#endif
+
+#endif
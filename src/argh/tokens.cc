@@ -0,0 +1,237 @@
+// src/argh/tokens.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the lazy tokenizers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "tokens.h"
+
+#include "scanner.h"
+
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace argh
+{
+    namespace
+    {
+        // Records what the scanner reports about a single argument.
+        // The owner of a positional argument is never looked at: for response files and
+        // command strings, it's a view into the previous argument, which has been overwritten.
+        struct capture : visitor
+        {
+            void on_argument(std::string_view text, token_kind kind)
+            {
+                this->argument = classified_argument{text, kind, std::string_view(), std::string_view(), text_problem::none};
+                if (kind == token_kind::short_cluster)
+                    this->argument.name = text;
+                this->seen = true;
+            }
+
+            void on_flag(std::string_view name)
+            {
+                if (this->argument.kind == token_kind::long_option)
+                    this->argument.name = name;
+            }
+
+            void on_parameter(std::string_view name, std::string_view value)
+            {
+                this->argument.name = name;
+                this->argument.value = value;
+            }
+
+            void on_invalid(std::string_view text, text_problem problem)
+            {
+                this->argument = classified_argument{text, token_kind::empty, std::string_view(), std::string_view(), problem};
+                this->seen = true;
+            }
+
+            // The argument.
+            classified_argument argument;
+
+            // Whether the scanner reported an argument, which it doesn't for empty ones.
+            bool seen = false;
+        };
+
+        // Reads characters from a stream.
+        struct stream_source
+        {
+            // Returns the next character.
+            //
+            //   * return (int) - The next character, or -1 at the end of the stream.
+            int get()
+            {
+                return this->in->get();
+            }
+
+            std::istream *in;
+        };
+
+        // Reads characters from a string that it owns.
+        struct string_source
+        {
+            // Returns the next character.
+            //
+            //   * return (int) - The next character, or -1 at the end of the string.
+            int get()
+            {
+                return this->next < this->text.length() ? (unsigned char)this->text[this->next++] : -1;
+            }
+
+            std::string text;
+            std::size_t next = 0;
+        };
+
+        // Returns whether a character separates arguments.
+        //
+        //   * int c - The character.
+        //
+        //   * return (bool) - True for whitespace.
+        bool is_separator(int c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        // Reads the next argument, undoing quotes and backslashes.
+        //
+        //   * source &in         - The characters.
+        //   * std::string &word  - The string to store the argument in. Its storage is reused.
+        //
+        //   * return (bool) - False if there are no more arguments.
+        template <typename source>
+        bool read_word(source &in, std::string &word)
+        {
+            word.clear();
+
+            int c = in.get();
+            while (is_separator(c))
+                c = in.get();
+            if (c == -1)
+                return false;
+
+            for (; c != -1 && !is_separator(c); c = in.get())
+            {
+                if (c == '\'')
+                {
+                    while ((c = in.get()) != -1 && c != '\'')
+                        word += (char)c;
+                }
+                else if (c == '"')
+                {
+                    while ((c = in.get()) != -1 && c != '"')
+                    {
+                        if (c == '\\' && (c = in.get()) == -1)
+                            break;
+                        word += (char)c;
+                    }
+                }
+                else if (c == '\\')
+                {
+                    if ((c = in.get()) == -1)
+                        break;
+                    word += (char)c;
+                }
+                else
+                {
+                    word += (char)c;
+                }
+
+                // An unterminated quote or escape ends the input.
+                if (c == -1)
+                    break;
+            }
+            return true;
+        }
+
+        // Splits characters into arguments, and classifies them one at a time.
+        //
+        //   * source in               - The characters.
+        //   * const options *registry - The registry to resolve long options against, or nullptr.
+        //
+        //   * return (generator<classified_argument>) - The arguments.
+        template <typename source>
+        generator<classified_argument> tokenize_words(source in, const options *registry)
+        {
+            scanner scan(registry);
+            capture v;
+            std::string word;
+            while (read_word(in, word))
+            {
+                v.seen = false;
+                scan.scan(word, v);
+                if (v.seen)
+                    co_yield v.argument;
+            }
+        }
+    }
+
+    // Tokenizes the argv vector that main receives, skipping the program name.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize(int argc, char *argv[], const options *registry)
+    {
+        scanner scan(registry);
+        capture v;
+        for (int i = 1; i < argc; i++)
+        {
+            v.seen = false;
+            scan.scan(argv[i], v);
+            if (v.seen)
+                co_yield v.argument;
+        }
+    }
+
+    // Tokenizes a span of arguments, starting at the first element.
+    //
+    //   * std::span<const std::string_view> argv - The arguments.
+    //   * const options *registry                - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize(std::span<const std::string_view> argv, const options *registry)
+    {
+        scanner scan(registry);
+        capture v;
+        for (std::string_view arg : argv)
+        {
+            v.seen = false;
+            scan.scan(arg, v);
+            if (v.seen)
+                co_yield v.argument;
+        }
+    }
+
+    // Tokenizes a response file.
+    //
+    //   * std::istream &in        - The response file.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize_file(std::istream &in, const options *registry)
+    {
+        return tokenize_words(stream_source{&in}, registry);
+    }
+
+    // Tokenizes a command string.
+    //
+    //   * std::string command     - The command string.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize_command(std::string command, const options *registry)
+    {
+        return tokenize_words(string_source{std::move(command)}, registry);
+    }
+}
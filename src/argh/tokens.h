@@ -0,0 +1,100 @@
+// src/argh/tokens.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the lazy tokenizer headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef TOKENS_H
+#define TOKENS_H
+
+#include "generator.h"
+#include "options.h"
+#include "token.h"
+#include "utf8.h"
+
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace argh
+{
+    // An argument, as the tokenizers yield it.
+    struct classified_argument
+    {
+        // The argument.
+        std::string_view text;
+
+        // The kind of the argument. Arguments after "--" are positional.
+        token_kind kind;
+
+        // For options, the name of the option, resolved against the registry if there is one.
+        // For short flag clusters, the whole cluster. Otherwise empty.
+        std::string_view name;
+
+        // For options given with '=', the value. Otherwise empty.
+        std::string_view value;
+
+        // If the registry validates arguments (see options::validate_text), what is wrong with this one.
+        // An invalid argument is not classified: its kind is token_kind::empty.
+        text_problem problem;
+    };
+
+    // The tokenizers classify arguments one at a time, as the consumer pulls them, using the
+    // same scanner as the argh class. Empty arguments are skipped. A consumer that stops early
+    // never reads, splits or classifies the rest of the input.
+    //
+    //    for (const argh::classified_argument &arg : argh::tokenize(argc, argv))
+    //    {
+    //        if (arg.kind == argh::token_kind::positional)
+    //            process(arg.text);
+    //    }
+    //
+    // The views in each argument are valid until the generator is resumed. Those from
+    // tokenize(argc, argv) also point into argv itself, and stay valid for as long as it does.
+
+    // Tokenizes the argv vector that main receives, skipping the program name.
+    //
+    //   * int argc                - The count of command line arguments.
+    //   * char *argv[]            - The command line arguments.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize(int argc, char *argv[], const options *registry = nullptr);
+
+    // Tokenizes a span of arguments, starting at the first element.
+    //
+    //   * std::span<const std::string_view> argv - The arguments. They must outlive the generator.
+    //   * const options *registry                - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize(std::span<const std::string_view> argv, const options *registry = nullptr);
+
+    // Tokenizes a response file, as given to a program with "@file".
+    // The arguments are separated by whitespace. Single quotes keep everything up to the next
+    // single quote; double quotes do the same, except that a backslash escapes the next character;
+    // outside of quotes, a backslash also escapes the next character.
+    // The stream is read one argument at a time, so only the argument being classified is in memory.
+    //
+    //   * std::istream &in        - The response file. It must outlive the generator.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize_file(std::istream &in, const options *registry = nullptr);
+
+    // Tokenizes a command string, split into arguments as a response file is.
+    //
+    //   * std::string command     - The command string.
+    //   * const options *registry - The registry to resolve long options against, or nullptr.
+    //
+    //   * return (generator<classified_argument>) - The arguments.
+    generator<classified_argument> tokenize_command(std::string command, const options *registry = nullptr);
+}
+
+#endif
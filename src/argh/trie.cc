@@ -0,0 +1,163 @@
+// src/argh/trie.cc
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the trie class.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "trie.h"
+#include "config.h"
+
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // The trie class is a compact prefix tree that maps strings to small non-negative integers.
+    // All of the nodes live in a single vector; each node links to its first child
+    // and to its next sibling, and siblings are kept sorted by their label.
+
+    // The zero-argument constructor that creates an empty trie.
+    ARGH_INLINE trie::trie()
+    {
+        this->nodes.push_back({'\0', -1, 0, -1, -1});
+    }
+
+    // Inserts a key into the trie. If the key is already present, its value is replaced.
+    //
+    //   * std::string_view key - The key to insert.
+    //   * int value            - The value of the key. Must be non-negative.
+    ARGH_INLINE void trie::insert(std::string_view key, int value)
+    {
+        // Only a new key changes the counts along its path.
+        int added = find(key) == not_found ? 1 : 0;
+
+        int current = 0;
+        this->nodes[current].count += added;
+        for (char label : key)
+        {
+            // Walk the sorted sibling list to find the child, or the place to insert it.
+            int previous = -1;
+            int next = this->nodes[current].first_child;
+            while (next != -1 && (unsigned char)this->nodes[next].label < (unsigned char)label)
+            {
+                previous = next;
+                next = this->nodes[next].next_sibling;
+            }
+
+            if (next != -1 && this->nodes[next].label == label)
+            {
+                current = next;
+                this->nodes[current].count += added;
+                continue;
+            }
+
+            int created = this->nodes.size();
+            this->nodes.push_back({label, -1, added, -1, next});
+            if (previous == -1)
+                this->nodes[current].first_child = created;
+            else
+                this->nodes[previous].next_sibling = created;
+            current = created;
+        }
+        this->nodes[current].value = value;
+    }
+
+    // Looks up a key in the trie.
+    //
+    //   * std::string_view key - The key to look up.
+    //
+    //   * return (int) - The value of the key, or -1 if the key is not present.
+    ARGH_INLINE int trie::find(std::string_view key) const
+    {
+        int current = walk(key);
+        if (current == -1)
+            return not_found;
+        return this->nodes[current].value;
+    }
+
+    // Looks up the single key that starts with the given prefix.
+    // A key that matches the prefix exactly always wins, as in getopt_long.
+    // Runs in O(L) time in the length of the prefix, plus the length of the completion.
+    //
+    //   * std::string_view prefix - The prefix to look up.
+    //
+    //   * return (int) - The value of the matching key, trie::not_found if no key matches,
+    //                    or trie::ambiguous if more than one key matches.
+    ARGH_INLINE int trie::find_prefix(std::string_view prefix) const
+    {
+        int current = walk(prefix);
+        if (current == -1 || this->nodes[current].count == 0)
+            return not_found;
+        if (this->nodes[current].value != -1)
+            return this->nodes[current].value;
+        if (this->nodes[current].count > 1)
+            return ambiguous;
+
+        // Exactly one key lies below this node, so there is a single path down to it.
+        while (this->nodes[current].value == -1)
+            current = this->nodes[current].first_child;
+        return this->nodes[current].value;
+    }
+
+    // Collects the values of all keys that start with the given prefix, in key order.
+    //
+    //   * std::string_view prefix   - The prefix to look up.
+    //   * std::vector<int> &values - The vector to append the values to.
+    ARGH_INLINE void trie::collect(std::string_view prefix, std::vector<int> &values) const
+    {
+        int current = walk(prefix);
+        if (current != -1)
+            collect_below(current, values);
+    }
+
+    // Returns the index of the child of a node with the given label.
+    //
+    //   * int parent - The index of the parent node.
+    //   * char label - The label of the child.
+    //
+    //   * return (int) - The index of the child, or -1 if there is none.
+    ARGH_INLINE int trie::child(int parent, char label) const
+    {
+        int next = this->nodes[parent].first_child;
+        while (next != -1 && (unsigned char)this->nodes[next].label < (unsigned char)label)
+            next = this->nodes[next].next_sibling;
+        if (next != -1 && this->nodes[next].label == label)
+            return next;
+        return -1;
+    }
+
+    // Returns the node reached by following a key from the root.
+    //
+    //   * std::string_view key - The key to follow.
+    //
+    //   * return (int) - The index of the node, or -1 if the key leaves the trie.
+    ARGH_INLINE int trie::walk(std::string_view key) const
+    {
+        int current = 0;
+        for (char label : key)
+        {
+            current = child(current, label);
+            if (current == -1)
+                return -1;
+        }
+        return current;
+    }
+
+    // Collects the values of all keys at or below a node, in key order.
+    //
+    //   * int current              - The index of the node.
+    //   * std::vector<int> &values - The vector to append the values to.
+    ARGH_INLINE void trie::collect_below(int current, std::vector<int> &values) const
+    {
+        if (this->nodes[current].value != -1)
+            values.push_back(this->nodes[current].value);
+        for (int next = this->nodes[current].first_child; next != -1; next = this->nodes[next].next_sibling)
+            collect_below(next, values);
+    }
+}
@@ -0,0 +1,117 @@
+// src/argh/trie.h
+// v0.4.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the trie headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef TRIE_H
+#define TRIE_H
+
+#include <string_view>
+#include <vector>
+
+namespace argh
+{
+    // A compact prefix tree that maps strings to small non-negative integers.
+    // All of the nodes live in a single vector; each node links to its first child
+    // and to its next sibling, and siblings are kept sorted by their label.
+    // Lookups run in O(L * F) time, where L is the length of the key
+    // and F is the number of distinct characters at each level.
+    class trie
+    {
+        public:
+        // The value returned by lookups that find no key.
+        static constexpr int not_found = -1;
+
+        // The value returned by prefix lookups that match more than one key.
+        static constexpr int ambiguous = -2;
+
+        // The zero-argument constructor that creates an empty trie.
+        trie();
+
+        // Inserts a key into the trie. If the key is already present, its value is replaced.
+        //
+        //   * std::string_view key - The key to insert.
+        //   * int value            - The value of the key. Must be non-negative.
+        void insert(std::string_view key, int value);
+
+        // Looks up a key in the trie.
+        //
+        //   * std::string_view key - The key to look up.
+        //
+        //   * return (int) - The value of the key, or trie::not_found if the key is not present.
+        int find(std::string_view key) const;
+
+        // Looks up the single key that starts with the given prefix.
+        // A key that matches the prefix exactly always wins, as in getopt_long.
+        // Runs in O(L) time in the length of the prefix, plus the length of the completion.
+        //
+        //   * std::string_view prefix - The prefix to look up.
+        //
+        //   * return (int) - The value of the matching key, trie::not_found if no key matches,
+        //                    or trie::ambiguous if more than one key matches.
+        int find_prefix(std::string_view prefix) const;
+
+        // Collects the values of all keys that start with the given prefix, in key order.
+        //
+        //   * std::string_view prefix   - The prefix to look up.
+        //   * std::vector<int> &values - The vector to append the values to.
+        void collect(std::string_view prefix, std::vector<int> &values) const;
+
+        private:
+        // A single node of the trie.
+        struct node
+        {
+            // The character on the edge leading into this node.
+            char label;
+
+            // The value of the key ending at this node, or -1 if no key ends here.
+            int value;
+
+            // The number of keys that end at this node or below it.
+            int count;
+
+            // The index of the first child of this node, or -1 if there is none.
+            int first_child;
+
+            // The index of the next sibling of this node, or -1 if there is none.
+            int next_sibling;
+        };
+
+        // Returns the index of the child of a node with the given label.
+        //
+        //   * int parent - The index of the parent node.
+        //   * char label - The label of the child.
+        //
+        //   * return (int) - The index of the child, or -1 if there is none.
+        int child(int parent, char label) const;
+
+        // Returns the node reached by following a key from the root.
+        //
+        //   * std::string_view key - The key to follow.
+        //
+        //   * return (int) - The index of the node, or -1 if the key leaves the trie.
+        int walk(std::string_view key) const;
+
+        // Collects the values of all keys at or below a node, in key order.
+        //
+        //   * int current              - The index of the node.
+        //   * std::vector<int> &values - The vector to append the values to.
+        void collect_below(int current, std::vector<int> &values) const;
+
+        // The nodes of the trie. The root is always at index 0.
+        std::vector<node> nodes;
+    };
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "trie.cc"
+#endif
+
+#endif
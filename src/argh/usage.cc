@@ -0,0 +1,90 @@
+// src/argh/usage.cc
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the implementation of the usage utility.
+// Use this utility to render a usage message from the registered options.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "usage.h"
+#include "options.h"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace argh
+{
+    // The indentation of each option, and the gap between an option and its description.
+    static const char indent[] = "  ";
+
+    // Renders the usage message for a program from its registered options.
+    // The message is measured first and then written into a single buffer of exactly that size.
+    //
+    //   * std::string_view program - The name of the program.
+    //   * const options &opts      - The registered options.
+    //
+    //   * return (std::string) - The usage message.
+    ARGH_COLD std::string usage(std::string_view program, const options &opts)
+    {
+        const std::string_view head = "Usage: ";
+        const std::string_view tail = opts.size() > 0 ? " [options]\n\nOptions:\n" : "\n";
+        const long unsigned int gap = sizeof(indent) - 1;
+
+        // The first pass measures the width of the option column and the size of the message.
+        long unsigned int width = 0;
+        long unsigned int descriptions = 0;
+        for (int id = 0; id < opts.size(); id++)
+        {
+            long unsigned int length = opts.name(id).length();
+            if (opts.value_name(id) != nullptr)
+                length += std::strlen(opts.value_name(id)) + 3;
+            if (length > width)
+                width = length;
+            if (opts.description(id) != nullptr)
+                descriptions += std::strlen(opts.description(id));
+        }
+        long unsigned int size = head.length() + program.length() + tail.length()
+                                 + opts.size() * (gap + width + gap + 1) + descriptions;
+
+        // The second pass writes the message.
+        std::string message(size, ' ');
+        char *cursor = message.data();
+        auto put = [&cursor](std::string_view text) {
+            std::memcpy(cursor, text.data(), text.length());
+            cursor += text.length();
+        };
+
+        put(head);
+        put(program);
+        put(tail);
+        for (int id = 0; id < opts.size(); id++)
+        {
+            char *column = cursor + gap;
+            cursor = column;
+            put(opts.name(id));
+            if (opts.value_name(id) != nullptr)
+            {
+                put(" <");
+                put(opts.value_name(id));
+                put(">");
+            }
+
+            // The padding is already spaces. Options without a description get no padding,
+            // so the message comes out a little shorter than measured.
+            if (opts.description(id) != nullptr)
+            {
+                cursor = column + width + gap;
+                put(opts.description(id));
+            }
+            *cursor++ = '\n';
+        }
+
+        message.resize(cursor - message.data());
+        return message;
+    }
+}
@@ -0,0 +1,57 @@
+// src/argh/usage.h
+// v0.1.0
+//
+// Author: Cayden Lund
+//   Date: 10/16/2026
+//
+// This file contains the usage headers.
+// Use this utility to render a usage message from the registered options.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef USAGE_H
+#define USAGE_H
+
+#include "options.h"
+
+#include <string>
+#include <string_view>
+
+// Marks a function as rarely called, so that the compiler never inlines it
+// and moves it away from the hot code of the program.
+#if defined(__GNUC__) || defined(__clang__)
+#define ARGH_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define ARGH_COLD __declspec(noinline)
+#else
+#define ARGH_COLD
+#endif
+
+namespace argh
+{
+    // Renders the usage message for a program from its registered options.
+    // Nothing is computed until this is called, so parsing pays nothing for help text.
+    //
+    //    if (args["-h"] || args["--help"])
+    //    {
+    //        std::cout << argh::usage(argv[0], opts);
+    //        return 0;
+    //    }
+    //
+    // The message looks like this:
+    //
+    //    Usage: prg [options]
+    //
+    //    Options:
+    //      -v               Print the version.
+    //      --output <file>  Write the output to <file>.
+    //
+    //   * std::string_view program - The name of the program.
+    //   * const options &opts      - The registered options.
+    //
+    //   * return (std::string) - The usage message.
+    ARGH_COLD std::string usage(std::string_view program, const options &opts);
+}
+
+#endif
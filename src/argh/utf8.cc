@@ -0,0 +1,372 @@
+// src/argh/utf8.cc
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the implementation of the text validation.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#include "utf8.h"
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ARGH_UTF8_X86 1
+#endif
+
+namespace argh
+{
+    // The implementations that check_text chooses between.
+    namespace utf8_detail
+    {
+        // Checks an argument one byte at a time.
+        //
+        //   * std::string_view text - The argument.
+        //
+        //   * return (text_problem) - What is wrong with the argument, or text_problem::none.
+        ARGH_INLINE text_problem check_scalar(std::string_view text)
+        {
+            const unsigned char *bytes = reinterpret_cast<const unsigned char *>(text.data());
+            std::size_t length = text.length();
+            bool control = false;
+
+            for (std::size_t i = 0; i < length;)
+            {
+                unsigned char lead = bytes[i];
+                if (lead < 0x80)
+                {
+                    control |= lead < 0x20 || lead == 0x7f;
+                    i++;
+                    continue;
+                }
+
+                std::size_t size;
+                std::uint32_t code_point, smallest;
+                if ((lead & 0xe0) == 0xc0)
+                {
+                    size = 2;
+                    code_point = lead & 0x1f;
+                    smallest = 0x80;
+                }
+                else if ((lead & 0xf0) == 0xe0)
+                {
+                    size = 3;
+                    code_point = lead & 0x0f;
+                    smallest = 0x800;
+                }
+                else if ((lead & 0xf8) == 0xf0)
+                {
+                    size = 4;
+                    code_point = lead & 0x07;
+                    smallest = 0x10000;
+                }
+                else
+                {
+                    return text_problem::invalid_utf8;
+                }
+
+                if (length - i < size)
+                    return text_problem::invalid_utf8;
+                for (std::size_t k = 1; k < size; k++)
+                {
+                    if ((bytes[i + k] & 0xc0) != 0x80)
+                        return text_problem::invalid_utf8;
+                    code_point = (code_point << 6) | (bytes[i + k] & 0x3f);
+                }
+                if (code_point < smallest || code_point > 0x10ffff || (code_point >= 0xd800 && code_point <= 0xdfff))
+                    return text_problem::invalid_utf8;
+                i += size;
+            }
+            return control ? text_problem::control_character : text_problem::none;
+        }
+
+#ifdef ARGH_UTF8_X86
+        // The errors that the lookup tables flag. A pair of bytes is invalid if all three lookups agree on an error.
+        // The first byte of the pair is indexed by its high and low nibbles, and the second by its high nibble.
+        ARGH_INLINE constexpr std::uint8_t too_short = 1 << 0;      // 11______ 0_______, or 11______ 11______
+        ARGH_INLINE constexpr std::uint8_t too_long = 1 << 1;       // 0_______ 10______
+        ARGH_INLINE constexpr std::uint8_t overlong_3 = 1 << 2;     // 11100000 100_____
+        ARGH_INLINE constexpr std::uint8_t too_large = 1 << 3;      // 11110100 1001____, 11110100 101_____, or past 11110100
+        ARGH_INLINE constexpr std::uint8_t surrogate = 1 << 4;      // 11101101 101_____
+        ARGH_INLINE constexpr std::uint8_t overlong_2 = 1 << 5;     // 1100000_ 10______
+        ARGH_INLINE constexpr std::uint8_t too_large_1000 = 1 << 6; // past 11110100, followed by 1000____
+        ARGH_INLINE constexpr std::uint8_t overlong_4 = 1 << 6;     // 11110000 1000____
+        ARGH_INLINE constexpr std::uint8_t two_conts = 1 << 7;      // 10______ 10______
+        ARGH_INLINE constexpr std::uint8_t carry = too_short | too_long | two_conts;
+
+        // The table of the first byte's high nibble.
+        ARGH_INLINE constexpr std::uint8_t byte_1_high[16] = {
+            too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+            two_conts, two_conts, two_conts, two_conts,
+            too_short | overlong_2,
+            too_short,
+            too_short | overlong_3 | surrogate,
+            too_short | too_large | too_large_1000 | overlong_4};
+
+        // The table of the first byte's low nibble.
+        ARGH_INLINE constexpr std::uint8_t byte_1_low[16] = {
+            carry | overlong_3 | overlong_2 | overlong_4,
+            carry | overlong_2,
+            carry,
+            carry,
+            carry | too_large,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000 | surrogate,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000};
+
+        // The table of the second byte's high nibble.
+        ARGH_INLINE constexpr std::uint8_t byte_2_high[16] = {
+            too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_short, too_short, too_short, too_short};
+
+        // The state carried from one block of 16 bytes to the next.
+        struct sse4_state
+        {
+            // Any error found so far.
+            __m128i error;
+
+            // The previous block.
+            __m128i previous;
+
+            // Where the previous block ends partway through a sequence.
+            __m128i incomplete;
+
+            // A bit for each control character found so far, in any block.
+            std::uint32_t controls;
+        };
+
+        // The state carried from one block of 32 bytes to the next.
+        struct avx2_state
+        {
+            __m256i error;
+            __m256i previous;
+            __m256i incomplete;
+            std::uint32_t controls;
+        };
+
+        // Checks a block of 16 bytes.
+        //
+        //   * __m128i input       - The block.
+        //   * std::uint32_t valid - A bit for each byte of the block that is part of the argument.
+        //   * sse4_state &state   - The state carried from the previous block.
+        __attribute__((target("sse4.1"))) inline void check_block(__m128i input, std::uint32_t valid, sse4_state &state)
+        {
+            const __m128i low_nibble = _mm_set1_epi8(0x0f);
+            __m128i control = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(input, _mm_set1_epi8(0x1f)), input),
+                                           _mm_cmpeq_epi8(input, _mm_set1_epi8(0x7f)));
+            state.controls |= (std::uint32_t)_mm_movemask_epi8(control) & valid;
+
+            if (_mm_movemask_epi8(input) == 0)
+            {
+                // An ASCII block is valid, unless the previous block was cut short.
+                state.error = _mm_or_si128(state.error, state.incomplete);
+            }
+            else
+            {
+                __m128i previous_1 = _mm_alignr_epi8(input, state.previous, 15);
+                __m128i previous_2 = _mm_alignr_epi8(input, state.previous, 14);
+                __m128i previous_3 = _mm_alignr_epi8(input, state.previous, 13);
+
+                __m128i high_1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_1_high)),
+                                                  _mm_and_si128(_mm_srli_epi16(previous_1, 4), low_nibble));
+                __m128i low_1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_1_low)),
+                                                 _mm_and_si128(previous_1, low_nibble));
+                __m128i high_2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_2_high)),
+                                                  _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+                __m128i special = _mm_and_si128(_mm_and_si128(high_1, low_1), high_2);
+
+                // The third and fourth bytes of a sequence must be continuations, which the tables don't cover.
+                __m128i third = _mm_subs_epu8(previous_2, _mm_set1_epi8((char)(0xe0 - 0x80)));
+                __m128i fourth = _mm_subs_epu8(previous_3, _mm_set1_epi8((char)(0xf0 - 0x80)));
+                __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+                state.error = _mm_or_si128(state.error, _mm_xor_si128(must_continue, special));
+            }
+
+            const __m128i last_leads = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     (char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+            state.incomplete = _mm_subs_epu8(input, last_leads);
+            state.previous = input;
+        }
+
+        // Checks an argument 16 bytes at a time.
+        //
+        //   * std::string_view text - The argument.
+        //
+        //   * return (text_problem) - What is wrong with the argument, or text_problem::none.
+        __attribute__((target("sse4.1"))) ARGH_INLINE text_problem check_sse4(std::string_view text)
+        {
+            sse4_state state{_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), 0};
+            std::size_t i = 0;
+            for (; i + 16 <= text.length(); i += 16)
+                check_block(_mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + i)), 0xffff, state);
+
+            // The rest is padded with zeros. Being ASCII, they also catch a sequence cut short at the end.
+            alignas(16) char tail[16] = {};
+            std::memcpy(tail, text.data() + i, text.length() - i);
+            check_block(_mm_load_si128(reinterpret_cast<const __m128i *>(tail)), (1u << (text.length() - i)) - 1, state);
+
+            if (!_mm_testz_si128(state.error, state.error))
+                return text_problem::invalid_utf8;
+            return state.controls != 0 ? text_problem::control_character : text_problem::none;
+        }
+
+        // Checks a block of 32 bytes.
+        //
+        //   * __m256i input       - The block.
+        //   * std::uint32_t valid - A bit for each byte of the block that is part of the argument.
+        //   * avx2_state &state   - The state carried from the previous block.
+        __attribute__((target("avx2"))) inline void check_block(__m256i input, std::uint32_t valid, avx2_state &state)
+        {
+            const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+            __m256i control = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(input, _mm256_set1_epi8(0x1f)), input),
+                                              _mm256_cmpeq_epi8(input, _mm256_set1_epi8(0x7f)));
+            state.controls |= (std::uint32_t)_mm256_movemask_epi8(control) & valid;
+
+            if (_mm256_movemask_epi8(input) == 0)
+            {
+                // An ASCII block is valid, unless the previous block was cut short.
+                state.error = _mm256_or_si256(state.error, state.incomplete);
+            }
+            else
+            {
+                // The bytes before each byte, across the two 128-bit lanes.
+                __m256i straddle = _mm256_permute2x128_si256(state.previous, input, 0x21);
+                __m256i previous_1 = _mm256_alignr_epi8(input, straddle, 15);
+                __m256i previous_2 = _mm256_alignr_epi8(input, straddle, 14);
+                __m256i previous_3 = _mm256_alignr_epi8(input, straddle, 13);
+
+                __m256i high_1 = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_1_high))),
+                                                     _mm256_and_si256(_mm256_srli_epi16(previous_1, 4), low_nibble));
+                __m256i low_1 = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_1_low))),
+                                                    _mm256_and_si256(previous_1, low_nibble));
+                __m256i high_2 = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(byte_2_high))),
+                                                     _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+                __m256i special = _mm256_and_si256(_mm256_and_si256(high_1, low_1), high_2);
+
+                // The third and fourth bytes of a sequence must be continuations, which the tables don't cover.
+                __m256i third = _mm256_subs_epu8(previous_2, _mm256_set1_epi8((char)(0xe0 - 0x80)));
+                __m256i fourth = _mm256_subs_epu8(previous_3, _mm256_set1_epi8((char)(0xf0 - 0x80)));
+                __m256i must_continue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+                state.error = _mm256_or_si256(state.error, _mm256_xor_si256(must_continue, special));
+            }
+
+            const __m256i last_leads = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                        (char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+            state.incomplete = _mm256_subs_epu8(input, last_leads);
+            state.previous = input;
+        }
+
+        // Checks an argument 32 bytes at a time.
+        //
+        //   * std::string_view text - The argument.
+        //
+        //   * return (text_problem) - What is wrong with the argument, or text_problem::none.
+        __attribute__((target("avx2"))) ARGH_INLINE text_problem check_avx2(std::string_view text)
+        {
+            avx2_state state{_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), 0};
+            std::size_t i = 0;
+            for (; i + 32 <= text.length(); i += 32)
+                check_block(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(text.data() + i)), 0xffffffff, state);
+
+            // The rest is padded with zeros. Being ASCII, they also catch a sequence cut short at the end.
+            alignas(32) char tail[32] = {};
+            std::memcpy(tail, text.data() + i, text.length() - i);
+            check_block(_mm256_load_si256(reinterpret_cast<const __m256i *>(tail)), (std::uint32_t)((1ull << (text.length() - i)) - 1), state);
+
+            if (!_mm256_testz_si256(state.error, state.error))
+                return text_problem::invalid_utf8;
+            return state.controls != 0 ? text_problem::control_character : text_problem::none;
+        }
+#endif
+
+        // Finds the fastest implementation that the processor supports.
+        //
+        //   * return (text_checker) - The implementation.
+        ARGH_INLINE text_checker fastest()
+        {
+            if (text_checker_supported(text_checker::avx2))
+                return text_checker::avx2;
+            if (text_checker_supported(text_checker::sse4))
+                return text_checker::sse4;
+            return text_checker::scalar;
+        }
+    }
+
+    // Returns whether the processor supports an implementation of check_text.
+    //
+    //   * text_checker checker - The implementation.
+    //
+    //   * return (bool) - Whether it can be used.
+    ARGH_INLINE bool text_checker_supported(text_checker checker)
+    {
+        switch (checker)
+        {
+#ifdef ARGH_UTF8_X86
+        case text_checker::sse4:
+            return __builtin_cpu_supports("sse4.1");
+        case text_checker::avx2:
+            return __builtin_cpu_supports("avx2");
+#else
+        case text_checker::sse4:
+        case text_checker::avx2:
+            return false;
+#endif
+        default:
+            return true;
+        }
+    }
+
+    // Checks that an argument is valid UTF-8, and holds no control characters.
+    //
+    //   * std::string_view text - The argument.
+    //   * text_checker checker  - The implementation to use.
+    //
+    //   * return (text_problem) - What is wrong with the argument, or text_problem::none.
+    ARGH_INLINE text_problem check_text(std::string_view text, text_checker checker)
+    {
+        using namespace utf8_detail;
+
+        static const text_checker best = fastest();
+        if (checker == text_checker::best)
+        {
+            // Most arguments are short, and padding them out to 32 bytes costs more than AVX2 saves.
+            checker = best == text_checker::avx2 && text.length() < 64 ? text_checker::sse4 : best;
+        }
+        else if (!text_checker_supported(checker))
+            checker = text_checker::scalar;
+
+        switch (checker)
+        {
+#ifdef ARGH_UTF8_X86
+        case text_checker::avx2:
+            return check_avx2(text);
+        case text_checker::sse4:
+            return check_sse4(text);
+#endif
+        default:
+            return check_scalar(text);
+        }
+    }
+}
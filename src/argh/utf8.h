@@ -0,0 +1,68 @@
+// src/argh/utf8.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the text validation headers.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <string_view>
+
+namespace argh
+{
+    // The ways in which an argument can fail validation.
+    enum class text_problem : unsigned char
+    {
+        // The argument is valid.
+        none,
+        // The argument is not valid UTF-8: a truncated or overlong sequence,
+        // a stray continuation byte, a surrogate, or a code point past U+10FFFF.
+        invalid_utf8,
+        // The argument is valid UTF-8, but holds a control character (U+0000 to U+001F, or U+007F).
+        control_character
+    };
+
+    // The implementations of check_text.
+    enum class text_checker : unsigned char
+    {
+        // The fastest implementation that the processor supports, for the length of the argument.
+        best,
+        // One byte at a time.
+        scalar,
+        // 16 bytes at a time, with SSE4.1.
+        sse4,
+        // 32 bytes at a time, with AVX2.
+        avx2
+    };
+
+    // Returns whether the processor supports an implementation of check_text.
+    //
+    //   * text_checker checker - The implementation.
+    //
+    //   * return (bool) - Whether it can be used.
+    bool text_checker_supported(text_checker checker);
+
+    // Checks that an argument is valid UTF-8, and holds no control characters.
+    // The vectorized implementations use the lookup-table algorithm of Keiser and Lemire:
+    // three table lookups classify every pair of adjacent bytes at once, so there is no branching per byte.
+    // Invalid UTF-8 is reported ahead of control characters.
+    //
+    //   * std::string_view text - The argument.
+    //   * text_checker checker  - The implementation to use. Unsupported ones fall back to scalar.
+    //
+    //   * return (text_problem) - What is wrong with the argument, or text_problem::none.
+    text_problem check_text(std::string_view text, text_checker checker = text_checker::best);
+}
+
+#ifdef ARGH_HEADER_ONLY
+#include "utf8.cc"
+#endif
+
+#endif
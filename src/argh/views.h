@@ -0,0 +1,143 @@
+// src/argh/views.h
+// v0.2.0
+//
+// Author: Cayden Lund
+//   Date: 10/17/2026
+//
+// This file contains the indexed_view class.
+// For use in the argh library.
+//
+// Copyright (C) 2021 Cayden Lund <https://github.com/shrimpster00>
+// License: MIT <opensource.org/licenses/MIT>
+
+#ifndef VIEWS_H
+#define VIEWS_H
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+namespace argh
+{
+    // A parameter, as listed by argh::parameters().
+    struct parameter_entry
+    {
+        // The name of the parameter.
+        std::string_view name;
+
+        // The value of the parameter.
+        std::string_view value;
+    };
+
+    // A read-only view of the elements 0 to size() - 1 of some storage, where each element
+    // is found from its index by a projection. Nothing is materialized: the view is
+    // a projection and a count, and dereferencing an iterator calls the projection.
+    //
+    // The iterators model std::random_access_iterator, so the view works with the std::ranges algorithms.
+    // When the projection returns a reference into stable storage, as those of the argh class do,
+    // they are also Cpp17 random access iterators, so the classic and parallel algorithms take them too.
+    // A projection that returns by value gives Cpp17 input iterators, like std::vector<bool>'s.
+    template <typename projection>
+    class indexed_view : public std::ranges::view_interface<indexed_view<projection>>
+    {
+        public:
+        // What the projection returns.
+        using result = std::invoke_result_t<const projection &, std::size_t>;
+
+        // The type of the elements.
+        using element = std::remove_cvref_t<result>;
+
+        // The iterator of an indexed_view.
+        class iterator
+        {
+            public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::conditional_t<std::is_lvalue_reference_v<result>,
+                                                         std::random_access_iterator_tag, std::input_iterator_tag>;
+            using value_type = element;
+            using difference_type = std::ptrdiff_t;
+            using reference = result;
+            using pointer = std::conditional_t<std::is_lvalue_reference_v<result>, const element *, void>;
+
+            // The zero-argument constructor that creates a singular iterator.
+            iterator() : project(), index(0)
+            {
+            }
+
+            // The two-argument constructor.
+            //
+            //   * projection project - The projection of the view.
+            //   * std::size_t index  - The index of the element.
+            iterator(projection project, std::size_t index) : project(project), index(index)
+            {
+            }
+
+            reference operator*() const { return this->project(this->index); }
+            reference operator[](difference_type n) const { return this->project(this->index + n); }
+
+            iterator &operator++() { this->index++; return *this; }
+            iterator operator++(int) { iterator old = *this; this->index++; return old; }
+            iterator &operator--() { this->index--; return *this; }
+            iterator operator--(int) { iterator old = *this; this->index--; return old; }
+            iterator &operator+=(difference_type n) { this->index += n; return *this; }
+            iterator &operator-=(difference_type n) { this->index -= n; return *this; }
+
+            friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const iterator &a, const iterator &b)
+            {
+                return (difference_type)a.index - (difference_type)b.index;
+            }
+
+            friend bool operator==(const iterator &a, const iterator &b) { return a.index == b.index; }
+            friend auto operator<=>(const iterator &a, const iterator &b) { return a.index <=> b.index; }
+
+            private:
+            // The projection of the view.
+            projection project;
+
+            // The index of the element.
+            std::size_t index;
+        };
+
+        // The zero-argument constructor that creates an empty view.
+        indexed_view() : project(), count(0)
+        {
+        }
+
+        // The two-argument constructor.
+        //
+        //   * projection project - Computes an element from its index.
+        //   * std::size_t count  - The number of elements.
+        indexed_view(projection project, std::size_t count) : project(project), count(count)
+        {
+        }
+
+        iterator begin() const { return iterator(this->project, 0); }
+        iterator end() const { return iterator(this->project, this->count); }
+
+        // Returns the number of elements.
+        //
+        //   * return (std::size_t) - The number of elements.
+        std::size_t size() const
+        {
+            return this->count;
+        }
+
+        private:
+        // Computes an element from its index.
+        projection project;
+
+        // The number of elements.
+        std::size_t count;
+    };
+}
+
+// The iterators of an indexed_view don't refer to the view itself, so they stay valid after it is gone.
+template <typename projection>
+inline constexpr bool std::ranges::enable_borrowed_range<argh::indexed_view<projection>> = true;
+
+#endif